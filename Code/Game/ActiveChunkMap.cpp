@@ -0,0 +1,85 @@
+#include "Game/ActiveChunkMap.hpp"
+
+
+
+ActiveChunkMap::ActiveChunkMap() :
+m_NumberOfChunks(0U)
+{
+	for (size_t slotIndex = 0; slotIndex < ACTIVE_CHUNK_MAP_CAPACITY; ++slotIndex)
+	{
+		m_ChunkCoordinates[slotIndex] = IntVector2::ZERO;
+		m_Chunks[slotIndex] = nullptr;
+	}
+}
+
+
+
+bool ActiveChunkMap::InsertChunk(Chunk* currentChunk)
+{
+	if (m_NumberOfChunks >= (ACTIVE_CHUNK_MAP_CAPACITY >> 1))
+	{
+		return false;
+	}
+
+	IntVector2 chunkCoordinates = currentChunk->GetChunkCoordinates();
+
+	size_t slotIndex;
+	if (FindSlotForChunkCoordinates(chunkCoordinates, slotIndex))
+	{
+		return false;
+	}
+
+	m_ChunkCoordinates[slotIndex] = chunkCoordinates;
+	m_Chunks[slotIndex] = currentChunk;
+	++m_NumberOfChunks;
+
+	return true;
+}
+
+
+
+bool ActiveChunkMap::RemoveChunk(const IntVector2& chunkCoordinates)
+{
+	size_t emptySlotIndex;
+	if (!FindSlotForChunkCoordinates(chunkCoordinates, emptySlotIndex))
+	{
+		return false;
+	}
+
+	size_t nextSlotIndex = (emptySlotIndex + 1U) & ACTIVE_CHUNK_MAP_MASK;
+	while (m_Chunks[nextSlotIndex] != nullptr)
+	{
+		size_t homeSlotIndex = GetHomeSlotForChunkCoordinates(m_ChunkCoordinates[nextSlotIndex]);
+
+		size_t distanceFromHomeSlot = (nextSlotIndex - homeSlotIndex) & ACTIVE_CHUNK_MAP_MASK;
+		size_t distanceFromEmptySlot = (nextSlotIndex - emptySlotIndex) & ACTIVE_CHUNK_MAP_MASK;
+
+		if (distanceFromHomeSlot >= distanceFromEmptySlot)
+		{
+			m_ChunkCoordinates[emptySlotIndex] = m_ChunkCoordinates[nextSlotIndex];
+			m_Chunks[emptySlotIndex] = m_Chunks[nextSlotIndex];
+			emptySlotIndex = nextSlotIndex;
+		}
+
+		nextSlotIndex = (nextSlotIndex + 1U) & ACTIVE_CHUNK_MAP_MASK;
+	}
+
+	m_ChunkCoordinates[emptySlotIndex] = IntVector2::ZERO;
+	m_Chunks[emptySlotIndex] = nullptr;
+	--m_NumberOfChunks;
+
+	return true;
+}
+
+
+
+void ActiveChunkMap::RemoveAllChunks()
+{
+	for (size_t slotIndex = 0; slotIndex < ACTIVE_CHUNK_MAP_CAPACITY; ++slotIndex)
+	{
+		m_ChunkCoordinates[slotIndex] = IntVector2::ZERO;
+		m_Chunks[slotIndex] = nullptr;
+	}
+
+	m_NumberOfChunks = 0U;
+}
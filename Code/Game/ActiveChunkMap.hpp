@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/Chunk.hpp"
+
+
+
+const int ACTIVE_CHUNK_MAP_BITS = 11;
+const size_t ACTIVE_CHUNK_MAP_CAPACITY = 1U << ACTIVE_CHUNK_MAP_BITS;
+const size_t ACTIVE_CHUNK_MAP_MASK = ACTIVE_CHUNK_MAP_CAPACITY - 1U;
+
+
+
+class ActiveChunkMap
+{
+public:
+	ActiveChunkMap();
+
+	Chunk* FindChunk(const IntVector2& chunkCoordinates) const;
+	bool InsertChunk(Chunk* currentChunk);
+	bool RemoveChunk(const IntVector2& chunkCoordinates);
+	void RemoveAllChunks();
+
+	size_t GetNumberOfChunks() const;
+
+private:
+	size_t GetHomeSlotForChunkCoordinates(const IntVector2& chunkCoordinates) const;
+	bool FindSlotForChunkCoordinates(const IntVector2& chunkCoordinates, size_t& slotIndex) const;
+
+private:
+	IntVector2 m_ChunkCoordinates[ACTIVE_CHUNK_MAP_CAPACITY];
+	Chunk* m_Chunks[ACTIVE_CHUNK_MAP_CAPACITY];
+	size_t m_NumberOfChunks;
+};
+
+
+
+inline Chunk* ActiveChunkMap::FindChunk(const IntVector2& chunkCoordinates) const
+{
+	size_t slotIndex;
+	if (FindSlotForChunkCoordinates(chunkCoordinates, slotIndex))
+	{
+		return m_Chunks[slotIndex];
+	}
+
+	return nullptr;
+}
+
+
+
+inline size_t ActiveChunkMap::GetNumberOfChunks() const
+{
+	return m_NumberOfChunks;
+}
+
+
+
+inline size_t ActiveChunkMap::GetHomeSlotForChunkCoordinates(const IntVector2& chunkCoordinates) const
+{
+	return static_cast<size_t>(Chunk::HashChunkCoordinates(chunkCoordinates) >> (32 - ACTIVE_CHUNK_MAP_BITS));
+}
+
+
+
+inline bool ActiveChunkMap::FindSlotForChunkCoordinates(const IntVector2& chunkCoordinates, size_t& slotIndex) const
+{
+	size_t currentSlotIndex = GetHomeSlotForChunkCoordinates(chunkCoordinates);
+
+	while (m_Chunks[currentSlotIndex] != nullptr)
+	{
+		if (m_ChunkCoordinates[currentSlotIndex] == chunkCoordinates)
+		{
+			slotIndex = currentSlotIndex;
+			return true;
+		}
+
+		currentSlotIndex = (currentSlotIndex + 1U) & ACTIVE_CHUNK_MAP_MASK;
+	}
+
+	slotIndex = currentSlotIndex;
+	return false;
+}
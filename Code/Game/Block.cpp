@@ -1,5 +1,31 @@
 #include "Game/Block.hpp"
 
+#include <stdio.h>
+#include <string.h>
+
+
+
+const char* BLOCK_DEFINITIONS_FILE_PATH = "Data/Definitions/BlockDefinitions.txt";
+const char BLOCK_DEFINITIONS_COMMENT_CHARACTER = '#';
+const char* NO_SOUND_FILE_NAME = "-";
+const int NUMBER_OF_BLOCK_DEFINITION_FIELDS = 15;
+
+const char* BLOCK_TYPE_NAMES[NUMBER_OF_BLOCKS_TYPES] =
+{
+	"Air",
+	"Grass",
+	"Dirt",
+	"Stone",
+	"Sand",
+	"Clay",
+	"Glowstone",
+	"Cobblestone",
+	"ClayBrick",
+	"StoneBrick",
+	"Water",
+	"Bedrock"
+};
+
 
 
 BlockDefinition::BlockDefinition()
@@ -11,219 +37,191 @@ BlockDefinition::BlockDefinition()
 
 void BlockDefinition::InitializeBlockDefinitions(const SpriteSheet& blockSpriteSheet)
 {
-	s_BlockDefinitions[AIR_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[AIR_BLOCK].m_Toughness = 0.0f;
-	s_BlockDefinitions[AIR_BLOCK].m_IsSolid = false;
-	s_BlockDefinitions[AIR_BLOCK].m_IsOpaque = false;
-	s_BlockDefinitions[AIR_BLOCK].m_IsVisible = false;
-	s_BlockDefinitions[AIR_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-	s_BlockDefinitions[AIR_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-	s_BlockDefinitions[AIR_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-
-	s_BlockDefinitions[GRASS_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[GRASS_BLOCK].m_Toughness = 3.0f;
-	s_BlockDefinitions[GRASS_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[GRASS_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[GRASS_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[GRASS_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 0));
-	s_BlockDefinitions[GRASS_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 0));
-	s_BlockDefinitions[GRASS_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 0));
-	s_BlockDefinitions[GRASS_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/GrassPlacingAndBreaking.ogg");
-	s_BlockDefinitions[GRASS_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/GrassPlacingAndBreaking.ogg");
-	s_BlockDefinitions[GRASS_BLOCK].m_Walking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/GrassWalking.ogg");
-
-	s_BlockDefinitions[DIRT_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[DIRT_BLOCK].m_Toughness = 3.0f;
-	s_BlockDefinitions[DIRT_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[DIRT_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[DIRT_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[DIRT_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 0));
-	s_BlockDefinitions[DIRT_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 0));
-	s_BlockDefinitions[DIRT_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 0));
-	s_BlockDefinitions[DIRT_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/DirtPlacingAndBreaking.ogg");
-	s_BlockDefinitions[DIRT_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/DirtPlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[STONE_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[STONE_BLOCK].m_Toughness = 5.0f;
-	s_BlockDefinitions[STONE_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[STONE_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[STONE_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[STONE_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 1));
-	s_BlockDefinitions[STONE_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 1));
-	s_BlockDefinitions[STONE_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 1));
-	s_BlockDefinitions[STONE_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/StonePlacingAndBreaking.ogg");
-	s_BlockDefinitions[STONE_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/StonePlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[SAND_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[SAND_BLOCK].m_Toughness = 1.0f;
-	s_BlockDefinitions[SAND_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[SAND_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[SAND_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[SAND_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 1));
-	s_BlockDefinitions[SAND_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 1));
-	s_BlockDefinitions[SAND_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 1));
-	s_BlockDefinitions[SAND_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/SandPlacingAndBreaking.ogg");
-	s_BlockDefinitions[SAND_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/SandPlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[CLAY_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[CLAY_BLOCK].m_Toughness = 2.0f;
-	s_BlockDefinitions[CLAY_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[CLAY_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[CLAY_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[CLAY_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 1));
-	s_BlockDefinitions[CLAY_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 1));
-	s_BlockDefinitions[CLAY_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 1));
-	s_BlockDefinitions[CLAY_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/ClayPlacingAndBreaking.ogg");
-	s_BlockDefinitions[CLAY_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/ClayPlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_illuminationValue = 12;
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_Toughness = 4.0f;
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 1));
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 1));
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 1));
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/GlowstonePlacingAndBreaking.ogg");
-	s_BlockDefinitions[GLOWSTONE_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/GlowstonePlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_Toughness = 4.0f;
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 2));
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 2));
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 2));
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/CobblestonePlacingAndBreaking.ogg");
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/CobblestonePlacingAndBreaking.ogg");
-	s_BlockDefinitions[COBBLESTONE_BLOCK].m_Walking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/CobblestoneWalking.ogg");
-
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_Toughness = 4.0f;
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 2));
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 2));
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(1, 2));
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/ClayBrickPlacingAndBreaking.ogg");
-	s_BlockDefinitions[CLAY_BRICK_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/ClayBrickPlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_Toughness = 4.0f;
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 2));
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 2));
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(2, 2));
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/StoneBrickPlacingAndBreaking.ogg");
-	s_BlockDefinitions[STONE_BRICK_BLOCK].m_Placing_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/StoneBrickPlacingAndBreaking.ogg");
-
-	s_BlockDefinitions[WATER_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[WATER_BLOCK].m_Toughness = 0.0f;
-	s_BlockDefinitions[WATER_BLOCK].m_IsSolid = false;
-	s_BlockDefinitions[WATER_BLOCK].m_IsOpaque = false;
-	s_BlockDefinitions[WATER_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[WATER_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-	s_BlockDefinitions[WATER_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-	s_BlockDefinitions[WATER_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(0, 0));
-	s_BlockDefinitions[WATER_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/WaterBreaking.ogg");
-
-	s_BlockDefinitions[BEDROCK_BLOCK].m_illuminationValue = 0;
-	s_BlockDefinitions[BEDROCK_BLOCK].m_Toughness = 10.0f;
-	s_BlockDefinitions[BEDROCK_BLOCK].m_IsSolid = true;
-	s_BlockDefinitions[BEDROCK_BLOCK].m_IsOpaque = true;
-	s_BlockDefinitions[BEDROCK_BLOCK].m_IsVisible = true;
-	s_BlockDefinitions[BEDROCK_BLOCK].m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 2));
-	s_BlockDefinitions[BEDROCK_BLOCK].m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 2));
-	s_BlockDefinitions[BEDROCK_BLOCK].m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(IntVector2(3, 2));
-	s_BlockDefinitions[BEDROCK_BLOCK].m_Breaking_Sound = AudioSystem::SingletonInstance()->CreateOrGetSound("Data/Sounds/BedrockBreaking.ogg");
+	BinaryFileReader fileReader;
+	bool fileExists = fileReader.OpenBinaryFile(BLOCK_DEFINITIONS_FILE_PATH);
+	ASSERT_OR_DIE(fileExists, "Block definitions file not found.");
+
+	size_t fileSize = fileReader.GetBinaryFileSize();
+	std::vector<char> fileContents(fileSize + 1U, '\0');
+	fileReader.ReadBytes(reinterpret_cast<uint8_t*>(fileContents.data()), fileSize);
+	fileReader.CloseBinaryFile();
+
+	bool blockTypeIsDefined[NUMBER_OF_BLOCKS_TYPES] = { false };
+
+	char* nextDefinitionLine = nullptr;
+	char* definitionLine = strtok_s(fileContents.data(), "\r\n", &nextDefinitionLine);
+	while (definitionLine != nullptr)
+	{
+		if (definitionLine[0] != BLOCK_DEFINITIONS_COMMENT_CHARACTER)
+		{
+			uint8_t blockType = LoadBlockDefinitionFromLine(definitionLine, blockSpriteSheet);
+			blockTypeIsDefined[blockType] = true;
+		}
+
+		definitionLine = strtok_s(nullptr, "\r\n", &nextDefinitionLine);
+	}
+
+	for (uint8_t blockType = 0; blockType < NUMBER_OF_BLOCKS_TYPES; ++blockType)
+	{
+		ASSERT_OR_DIE(blockTypeIsDefined[blockType], "Block type missing from block definitions file.");
+	}
+
+	CalculateBlockPropertiesChecksum();
 }
 
 
 
-BlockDefinition BlockDefinition::s_BlockDefinitions[NUMBER_OF_BLOCKS_TYPES];
-
-
-
-Block::Block()
+void BlockDefinition::CalculateBlockPropertiesChecksum()
 {
+	s_BlockPropertiesChecksum = 2166136261U;
 
+	for (uint8_t blockType = 0; blockType < NUMBER_OF_BLOCKS_TYPES; ++blockType)
+	{
+		s_BlockPropertiesChecksum ^= s_BlockProperties[blockType];
+		s_BlockPropertiesChecksum *= 16777619U;
+	}
 }
 
 
 
-Block::Block(uint8_t blockType) : m_lightAndFlags(0)
+uint8_t BlockDefinition::LoadBlockDefinitionFromLine(const char* definitionLine, const SpriteSheet& blockSpriteSheet)
 {
-	m_BlockType = blockType;
+	char blockTypeName[32];
+	int illuminationValue;
+	float toughness;
+	int isSolid;
+	int isOpaque;
+	int isVisible;
+	IntVector2 topFaceSpriteCoords;
+	IntVector2 bottomFaceSpriteCoords;
+	IntVector2 sideFaceSpriteCoords;
+	char breakingSoundFileName[64];
+	char placingSoundFileName[64];
+	char walkingSoundFileName[64];
+
+	int numberOfFields = sscanf_s(definitionLine, "%31s %d %f %d %d %d %d,%d %d,%d %d,%d %63s %63s %63s",
+		blockTypeName, static_cast<unsigned int>(sizeof(blockTypeName)),
+		&illuminationValue, &toughness, &isSolid, &isOpaque, &isVisible,
+		&topFaceSpriteCoords.X, &topFaceSpriteCoords.Y,
+		&bottomFaceSpriteCoords.X, &bottomFaceSpriteCoords.Y,
+		&sideFaceSpriteCoords.X, &sideFaceSpriteCoords.Y,
+		breakingSoundFileName, static_cast<unsigned int>(sizeof(breakingSoundFileName)),
+		placingSoundFileName, static_cast<unsigned int>(sizeof(placingSoundFileName)),
+		walkingSoundFileName, static_cast<unsigned int>(sizeof(walkingSoundFileName)));
+
+	ASSERT_OR_DIE(numberOfFields == NUMBER_OF_BLOCK_DEFINITION_FIELDS, "Malformed block definition.");
+	ASSERT_OR_DIE(illuminationValue >= 0 && illuminationValue <= MAXIMUM_BLOCK_ILLUMINATION_VALUE, "Block illumination value out of range.");
+
+	uint8_t blockType = GetBlockTypeForName(blockTypeName);
+	ASSERT_OR_DIE(blockType != INVALID_BLOCK, "Unknown block type in block definitions file.");
+
+	uint8_t blockProperties = static_cast<uint8_t>(illuminationValue << BLOCK_ILLUMINATION_SHIFT);
+	if (isSolid != 0)
+	{
+		SetBits(blockProperties, BLOCK_SOLID_MASK);
+	}
+
+	if (isOpaque != 0)
+	{
+		SetBits(blockProperties, BLOCK_OPAQUE_MASK);
+	}
+
+	if (isVisible != 0)
+	{
+		SetBits(blockProperties, BLOCK_VISIBLE_MASK);
+	}
+
+	if (illuminationValue > 0)
+	{
+		SetBits(blockProperties, BLOCK_EMISSIVE_MASK);
+	}
+
+	s_BlockProperties[blockType] = blockProperties;
+
+	BlockDefinition& blockDefinition = s_BlockDefinitions[blockType];
+	blockDefinition.m_Toughness = toughness;
+	blockDefinition.m_topFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(topFaceSpriteCoords);
+	blockDefinition.m_bottomFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(bottomFaceSpriteCoords);
+	blockDefinition.m_sideFaceTextureAABB = blockSpriteSheet.GetTextureCoordsForSpriteCoords(sideFaceSpriteCoords);
+	blockDefinition.m_Breaking_Sound = GetSoundForFileName(breakingSoundFileName);
+	blockDefinition.m_Placing_Sound = GetSoundForFileName(placingSoundFileName);
+	blockDefinition.m_Walking_Sound = GetSoundForFileName(walkingSoundFileName);
+
+	return blockType;
 }
 
 
 
-int Block::GetInternalIlluminationValue() const
+uint8_t BlockDefinition::GetBlockTypeForName(const char* blockTypeName)
 {
-	return BlockDefinition::s_BlockDefinitions[m_BlockType].m_illuminationValue;
+	for (uint8_t blockType = 0; blockType < NUMBER_OF_BLOCKS_TYPES; ++blockType)
+	{
+		if (strcmp(blockTypeName, BLOCK_TYPE_NAMES[blockType]) == 0)
+		{
+			return blockType;
+		}
+	}
+
+	return INVALID_BLOCK;
 }
 
 
 
-void Block::SetSkyBit()
+SoundID BlockDefinition::GetSoundForFileName(const char* soundFileName)
 {
-	SetBits(m_lightAndFlags, SKY_FLAG_MASK);
-}
-
+	if (strcmp(soundFileName, NO_SOUND_FILE_NAME) == 0)
+	{
+		return SoundID();
+	}
 
+	char soundFilePath[128];
+	sprintf_s(soundFilePath, "Data/Sounds/%s", soundFileName);
 
-void Block::ClearSkyBit()
-{
-	ClearBits(m_lightAndFlags, SKY_FLAG_MASK);
+	return AudioSystem::SingletonInstance()->CreateOrGetSound(soundFilePath);
 }
 
 
 
-void Block::SetLightingDirty()
-{
-	SetBits(m_lightAndFlags, LIGHTING_DIRTY_MASK);
-}
+uint8_t BlockDefinition::s_BlockProperties[NUMBER_OF_BLOCKS_TYPES];
+uint32_t BlockDefinition::s_BlockPropertiesChecksum = 0U;
+BlockDefinition BlockDefinition::s_BlockDefinitions[NUMBER_OF_BLOCKS_TYPES];
 
 
 
-void Block::ClearLightingDirty()
+Block::Block()
 {
-	ClearBits(m_lightAndFlags, LIGHTING_DIRTY_MASK);
+
 }
 
 
 
-bool Block::IsSky()
+Block::Block(uint8_t blockType) : m_packedLight(0)
 {
-	return ((m_lightAndFlags & SKY_FLAG_MASK) == SKY_FLAG_MASK);
+	m_BlockType = blockType;
 }
 
 
 
-bool Block::LightingIsDirty()
+Block::Block(uint8_t blockType, uint8_t packedLight) : m_packedLight(packedLight)
 {
-	return ((m_lightAndFlags & LIGHTING_DIRTY_MASK) == LIGHTING_DIRTY_MASK);
+	m_BlockType = blockType;
 }
 
 
 
-void Block::SetLightValue(int lightValue)
+void Block::SetLightValue(uint8_t lightChannel, int lightValue)
 {
-	unsigned char requiredLightValue = static_cast<unsigned char>(lightValue);
+	int channelShift = lightChannel * LIGHT_CHANNEL_BITS;
 
-	ClearBits(m_lightAndFlags, LIGHT_VALUE_MASK);
-	SetBits(m_lightAndFlags, requiredLightValue);
+	ClearBits(m_packedLight, static_cast<unsigned char>(LIGHT_CHANNEL_MASK << channelShift));
+	SetBits(m_packedLight, static_cast<unsigned char>(lightValue << channelShift));
 }
 
 
 
-int Block::GetLightValue()
+int Block::GetLightValue(uint8_t lightChannel) const
 {
-	int lightValue = static_cast<int>(m_lightAndFlags & LIGHT_VALUE_MASK);
+	int lightValue = static_cast<int>((m_packedLight >> (lightChannel * LIGHT_CHANNEL_BITS)) & LIGHT_CHANNEL_MASK);
 
 	return lightValue;
 }
\ No newline at end of file
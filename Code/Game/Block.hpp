@@ -24,23 +24,51 @@ enum BlockType : uint8_t
 
 
 
+enum LightChannel : uint8_t
+{
+	BLOCK_LIGHT_CHANNEL,
+	SKY_LIGHT_CHANNEL,
+	NUMBER_OF_LIGHT_CHANNELS
+};
+
+
+
+const uint8_t BLOCK_SOLID_MASK = 0x01;
+const uint8_t BLOCK_OPAQUE_MASK = 0x02;
+const uint8_t BLOCK_VISIBLE_MASK = 0x04;
+const uint8_t BLOCK_EMISSIVE_MASK = 0x08;
+const int BLOCK_ILLUMINATION_SHIFT = 4;
+const int MAXIMUM_BLOCK_ILLUMINATION_VALUE = 15;
+
+
+
 class BlockDefinition
 {
 public:
 	BlockDefinition();
 	static void InitializeBlockDefinitions(const SpriteSheet& blockSpriteSheet);
 
+	static bool IsSolid(uint8_t blockType);
+	static bool IsOpaque(uint8_t blockType);
+	static bool IsVisible(uint8_t blockType);
+	static bool IsEmissive(uint8_t blockType);
+	static int GetIlluminationValue(uint8_t blockType);
+	static uint32_t GetBlockPropertiesChecksum();
+
+private:
+	static void CalculateBlockPropertiesChecksum();
+	static uint8_t LoadBlockDefinitionFromLine(const char* definitionLine, const SpriteSheet& blockSpriteSheet);
+	static uint8_t GetBlockTypeForName(const char* blockTypeName);
+	static SoundID GetSoundForFileName(const char* soundFileName);
+
 public:
+	static uint8_t s_BlockProperties[NUMBER_OF_BLOCKS_TYPES];
+	static uint32_t s_BlockPropertiesChecksum;
 	static BlockDefinition s_BlockDefinitions[NUMBER_OF_BLOCKS_TYPES];
 
 public:
-	int m_illuminationValue;
 	float m_Toughness;
 
-	bool m_IsSolid;
-	bool m_IsOpaque;
-	bool m_IsVisible;
-
 	AABB2 m_topFaceTextureAABB;
 	AABB2 m_bottomFaceTextureAABB;
 	AABB2 m_sideFaceTextureAABB;
@@ -52,11 +80,54 @@ public:
 
 
 
+inline bool BlockDefinition::IsSolid(uint8_t blockType)
+{
+	return ((s_BlockProperties[blockType] & BLOCK_SOLID_MASK) != 0U);
+}
+
+
+
+inline bool BlockDefinition::IsOpaque(uint8_t blockType)
+{
+	return ((s_BlockProperties[blockType] & BLOCK_OPAQUE_MASK) != 0U);
+}
+
+
+
+inline bool BlockDefinition::IsVisible(uint8_t blockType)
+{
+	return ((s_BlockProperties[blockType] & BLOCK_VISIBLE_MASK) != 0U);
+}
+
+
+
+inline bool BlockDefinition::IsEmissive(uint8_t blockType)
+{
+	return ((s_BlockProperties[blockType] & BLOCK_EMISSIVE_MASK) != 0U);
+}
+
+
+
+inline int BlockDefinition::GetIlluminationValue(uint8_t blockType)
+{
+	return static_cast<int>(s_BlockProperties[blockType] >> BLOCK_ILLUMINATION_SHIFT);
+}
+
+
+
+inline uint32_t BlockDefinition::GetBlockPropertiesChecksum()
+{
+	return s_BlockPropertiesChecksum;
+}
+
+
+
 class Block
 {
 public:
 	Block();
 	Block(uint8_t blockType);
+	Block(uint8_t blockType, uint8_t packedLight);
 
 	uint8_t GetType() const;
 	void SetType(uint8_t blockType);
@@ -75,21 +146,14 @@ public:
 
 	int GetInternalIlluminationValue() const;
 
-	void SetSkyBit();
-	void ClearSkyBit();
-
-	void SetLightingDirty();
-	void ClearLightingDirty();
+	void SetLightValue(uint8_t lightChannel, int lightValue);
+	int GetLightValue(uint8_t lightChannel) const;
 
-	bool IsSky();
-	bool LightingIsDirty();
-
-	void SetLightValue(int lightValue);
-	int GetLightValue();
+	uint8_t GetPackedLight() const;
 
 private:
 	uint8_t m_BlockType;
-	uint8_t m_lightAndFlags;
+	uint8_t m_packedLight;
 };
 
 
@@ -108,23 +172,37 @@ inline void Block::SetType(uint8_t blockType)
 
 
 
+inline uint8_t Block::GetPackedLight() const
+{
+	return m_packedLight;
+}
+
+
+
 inline bool Block::IsSolid() const
 {
-	return BlockDefinition::s_BlockDefinitions[m_BlockType].m_IsSolid;
+	return BlockDefinition::IsSolid(m_BlockType);
 }
 
 
 
 inline bool Block::IsOpaque() const
 {
-	return BlockDefinition::s_BlockDefinitions[m_BlockType].m_IsOpaque;
+	return BlockDefinition::IsOpaque(m_BlockType);
 }
 
 
 
 inline bool Block::IsVisible() const
 {
-	return BlockDefinition::s_BlockDefinitions[m_BlockType].m_IsVisible;
+	return BlockDefinition::IsVisible(m_BlockType);
+}
+
+
+
+inline int Block::GetInternalIlluminationValue() const
+{
+	return BlockDefinition::GetIlluminationValue(m_BlockType);
 }
 
 
@@ -31,14 +31,64 @@ bool BlockInfo::operator==(const BlockInfo& blockInfo)
 
 
 
-Block* BlockInfo::GetBlock()
+Block BlockInfo::GetBlock()
 {
 	if (m_ChunkOfBlock != nullptr)
 	{
-		return &(m_ChunkOfBlock->m_Blocks[m_BlockIndex]);
+		return m_ChunkOfBlock->GetBlock(m_BlockIndex);
 	}
 
-	return nullptr;
+	return Block(AIR_BLOCK);
+}
+
+
+
+uint8_t BlockInfo::GetBlockType()
+{
+	if (m_ChunkOfBlock != nullptr)
+	{
+		return m_ChunkOfBlock->GetBlockType(m_BlockIndex);
+	}
+
+	return AIR_BLOCK;
+}
+
+
+
+void BlockInfo::SetBlockType(uint8_t blockType)
+{
+	m_ChunkOfBlock->SetBlockType(m_BlockIndex, blockType);
+}
+
+
+
+int BlockInfo::GetLightValue(uint8_t lightChannel)
+{
+	if (m_ChunkOfBlock != nullptr)
+	{
+		return m_ChunkOfBlock->GetLightValue(m_BlockIndex, lightChannel);
+	}
+
+	return 0;
+}
+
+
+
+void BlockInfo::SetLightValue(uint8_t lightChannel, int lightValue)
+{
+	m_ChunkOfBlock->SetLightValue(m_BlockIndex, lightChannel, lightValue);
+}
+
+
+
+bool BlockInfo::IsSky()
+{
+	if (m_ChunkOfBlock != nullptr)
+	{
+		return m_ChunkOfBlock->IsSky(m_BlockIndex);
+	}
+
+	return false;
 }
 
 
@@ -14,7 +14,13 @@ public:
 
 	bool operator==(const BlockInfo& blockInfo);
 
-	Block* GetBlock();
+	Block GetBlock();
+	uint8_t GetBlockType();
+	void SetBlockType(uint8_t blockType);
+
+	int GetLightValue(uint8_t lightChannel);
+	void SetLightValue(uint8_t lightChannel, int lightValue);
+	bool IsSky();
 
 	Chunk* GetChunk();
 	int GetBlockIndex();
@@ -0,0 +1,235 @@
+#include "Game/BlockTypeStorage.hpp"
+
+#include <string.h>
+
+
+
+BlockTypeStorage::BlockTypeStorage() :
+m_UsesPalette(false)
+{
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		m_SectionBitsPerIndex[sectionIndex] = 0;
+	}
+
+	InitializeBlockTypes(AIR_BLOCK);
+}
+
+
+
+void BlockTypeStorage::InitializeBlockTypes(uint8_t blockType)
+{
+	if (!m_UsesPalette)
+	{
+		m_FlatBlockTypes.assign(NUMBER_OF_BLOCKS_PER_CHUNK, blockType);
+		return;
+	}
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		m_SectionPalettes[sectionIndex].assign(1U, blockType);
+		ResizeSectionIndices(sectionIndex, 0);
+	}
+}
+
+
+
+void BlockTypeStorage::SetUsesPalette(bool usesPalette)
+{
+	if (usesPalette == m_UsesPalette)
+	{
+		return;
+	}
+
+	if (usesPalette)
+	{
+		std::vector<uint8_t> flatBlockTypes;
+		flatBlockTypes.swap(m_FlatBlockTypes);
+
+		m_UsesPalette = true;
+		CopyFromBlockTypes(flatBlockTypes.data());
+	}
+	else
+	{
+		std::vector<uint8_t> flatBlockTypes(NUMBER_OF_BLOCKS_PER_CHUNK);
+		CopyToBlockTypes(flatBlockTypes.data());
+
+		for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+		{
+			std::vector<uint8_t>().swap(m_SectionPalettes[sectionIndex]);
+			std::vector<uint8_t>().swap(m_SectionIndices[sectionIndex]);
+			m_SectionBitsPerIndex[sectionIndex] = 0;
+		}
+
+		m_UsesPalette = false;
+		m_FlatBlockTypes.swap(flatBlockTypes);
+	}
+}
+
+
+
+void BlockTypeStorage::SetBlockType(int localIndex, uint8_t blockType)
+{
+	if (!m_UsesPalette)
+	{
+		m_FlatBlockTypes[localIndex] = blockType;
+		return;
+	}
+
+	int sectionIndex = localIndex >> BLOCK_BITS_PER_SECTION;
+	std::vector<uint8_t>& sectionPalette = m_SectionPalettes[sectionIndex];
+
+	size_t paletteIndex = 0U;
+	while (paletteIndex < sectionPalette.size() && sectionPalette[paletteIndex] != blockType)
+	{
+		++paletteIndex;
+	}
+
+	if (paletteIndex == sectionPalette.size())
+	{
+		sectionPalette.push_back(blockType);
+
+		int requiredBitsPerIndex = GetBitsPerIndexForPaletteSize(sectionPalette.size());
+		if (requiredBitsPerIndex > m_SectionBitsPerIndex[sectionIndex])
+		{
+			ResizeSectionIndices(sectionIndex, requiredBitsPerIndex);
+		}
+	}
+
+	if (m_SectionBitsPerIndex[sectionIndex] > 0)
+	{
+		SetPaletteIndex(sectionIndex, localIndex & SECTION_BLOCKS_MASK, static_cast<uint8_t>(paletteIndex));
+	}
+}
+
+
+
+void BlockTypeStorage::CopyFromBlockTypes(const uint8_t* blockTypes)
+{
+	if (!m_UsesPalette)
+	{
+		m_FlatBlockTypes.resize(NUMBER_OF_BLOCKS_PER_CHUNK);
+		memcpy(m_FlatBlockTypes.data(), blockTypes, NUMBER_OF_BLOCKS_PER_CHUNK);
+		return;
+	}
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		WriteSectionFromBlockTypes(sectionIndex, &blockTypes[sectionIndex << BLOCK_BITS_PER_SECTION]);
+	}
+}
+
+
+
+void BlockTypeStorage::CopyToBlockTypes(uint8_t* blockTypes) const
+{
+	if (!m_UsesPalette)
+	{
+		memcpy(blockTypes, m_FlatBlockTypes.data(), NUMBER_OF_BLOCKS_PER_CHUNK);
+		return;
+	}
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		ReadSectionToBlockTypes(sectionIndex, &blockTypes[sectionIndex << BLOCK_BITS_PER_SECTION]);
+	}
+}
+
+
+
+size_t BlockTypeStorage::GetNumberOfBytes() const
+{
+	if (!m_UsesPalette)
+	{
+		return m_FlatBlockTypes.capacity();
+	}
+
+	size_t numberOfBytes = 0U;
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		numberOfBytes += m_SectionPalettes[sectionIndex].capacity() + m_SectionIndices[sectionIndex].capacity();
+	}
+
+	return numberOfBytes;
+}
+
+
+
+void BlockTypeStorage::WriteSectionFromBlockTypes(int sectionIndex, const uint8_t* sectionBlockTypes)
+{
+	std::vector<uint8_t>& sectionPalette = m_SectionPalettes[sectionIndex];
+	sectionPalette.clear();
+
+	uint8_t paletteIndices[256];
+	memset(paletteIndices, 0xFF, sizeof(paletteIndices));
+
+	for (int sectionBlockIndex = 0; sectionBlockIndex < NUMBER_OF_BLOCKS_PER_SECTION; ++sectionBlockIndex)
+	{
+		uint8_t blockType = sectionBlockTypes[sectionBlockIndex];
+		if (paletteIndices[blockType] == 0xFF)
+		{
+			paletteIndices[blockType] = static_cast<uint8_t>(sectionPalette.size());
+			sectionPalette.push_back(blockType);
+		}
+	}
+
+	sectionPalette.shrink_to_fit();
+	m_SectionBitsPerIndex[sectionIndex] = 0;
+	ResizeSectionIndices(sectionIndex, GetBitsPerIndexForPaletteSize(sectionPalette.size()));
+
+	if (m_SectionBitsPerIndex[sectionIndex] == 0)
+	{
+		return;
+	}
+
+	for (int sectionBlockIndex = 0; sectionBlockIndex < NUMBER_OF_BLOCKS_PER_SECTION; ++sectionBlockIndex)
+	{
+		SetPaletteIndex(sectionIndex, sectionBlockIndex, paletteIndices[sectionBlockTypes[sectionBlockIndex]]);
+	}
+}
+
+
+
+void BlockTypeStorage::ReadSectionToBlockTypes(int sectionIndex, uint8_t* sectionBlockTypes) const
+{
+	const std::vector<uint8_t>& sectionPalette = m_SectionPalettes[sectionIndex];
+
+	if (m_SectionBitsPerIndex[sectionIndex] == 0)
+	{
+		memset(sectionBlockTypes, sectionPalette[0], NUMBER_OF_BLOCKS_PER_SECTION);
+		return;
+	}
+
+	for (int sectionBlockIndex = 0; sectionBlockIndex < NUMBER_OF_BLOCKS_PER_SECTION; ++sectionBlockIndex)
+	{
+		sectionBlockTypes[sectionBlockIndex] = sectionPalette[GetPaletteIndex(sectionIndex, sectionBlockIndex)];
+	}
+}
+
+
+
+void BlockTypeStorage::ResizeSectionIndices(int sectionIndex, int bitsPerIndex)
+{
+	uint8_t paletteIndices[NUMBER_OF_BLOCKS_PER_SECTION];
+	bool indicesArePreserved = (m_SectionBitsPerIndex[sectionIndex] > 0 && bitsPerIndex > 0);
+
+	if (indicesArePreserved)
+	{
+		for (int sectionBlockIndex = 0; sectionBlockIndex < NUMBER_OF_BLOCKS_PER_SECTION; ++sectionBlockIndex)
+		{
+			paletteIndices[sectionBlockIndex] = GetPaletteIndex(sectionIndex, sectionBlockIndex);
+		}
+	}
+
+	std::vector<uint8_t> sectionIndices((NUMBER_OF_BLOCKS_PER_SECTION * bitsPerIndex) >> 3, 0U);
+	m_SectionIndices[sectionIndex].swap(sectionIndices);
+	m_SectionBitsPerIndex[sectionIndex] = bitsPerIndex;
+
+	if (indicesArePreserved)
+	{
+		for (int sectionBlockIndex = 0; sectionBlockIndex < NUMBER_OF_BLOCKS_PER_SECTION; ++sectionBlockIndex)
+		{
+			SetPaletteIndex(sectionIndex, sectionBlockIndex, paletteIndices[sectionBlockIndex]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/Block.hpp"
+
+
+
+const int SECTION_BLOCKS_MASK = NUMBER_OF_BLOCKS_PER_SECTION - 1;
+const int MAXIMUM_BITS_PER_PALETTE_INDEX = 8;
+
+
+
+class BlockTypeStorage
+{
+public:
+	BlockTypeStorage();
+
+	void InitializeBlockTypes(uint8_t blockType);
+
+	bool UsesPalette() const;
+	void SetUsesPalette(bool usesPalette);
+
+	uint8_t GetBlockType(int localIndex) const;
+	void SetBlockType(int localIndex, uint8_t blockType);
+
+	void CopyFromBlockTypes(const uint8_t* blockTypes);
+	void CopyToBlockTypes(uint8_t* blockTypes) const;
+
+	size_t GetNumberOfBytes() const;
+
+	static int GetBitsPerIndexForPaletteSize(size_t paletteSize);
+
+private:
+	void WriteSectionFromBlockTypes(int sectionIndex, const uint8_t* sectionBlockTypes);
+	void ReadSectionToBlockTypes(int sectionIndex, uint8_t* sectionBlockTypes) const;
+	void ResizeSectionIndices(int sectionIndex, int bitsPerIndex);
+
+	uint8_t GetPaletteIndex(int sectionIndex, int sectionBlockIndex) const;
+	void SetPaletteIndex(int sectionIndex, int sectionBlockIndex, uint8_t paletteIndex);
+
+private:
+	bool m_UsesPalette;
+	std::vector<uint8_t> m_FlatBlockTypes;
+
+	std::vector<uint8_t> m_SectionPalettes[NUMBER_OF_SECTIONS];
+	std::vector<uint8_t> m_SectionIndices[NUMBER_OF_SECTIONS];
+	int m_SectionBitsPerIndex[NUMBER_OF_SECTIONS];
+};
+
+
+
+inline bool BlockTypeStorage::UsesPalette() const
+{
+	return m_UsesPalette;
+}
+
+
+
+inline uint8_t BlockTypeStorage::GetBlockType(int localIndex) const
+{
+	if (!m_UsesPalette)
+	{
+		return m_FlatBlockTypes[localIndex];
+	}
+
+	int sectionIndex = localIndex >> BLOCK_BITS_PER_SECTION;
+	if (m_SectionBitsPerIndex[sectionIndex] == 0)
+	{
+		return m_SectionPalettes[sectionIndex][0];
+	}
+
+	uint8_t paletteIndex = GetPaletteIndex(sectionIndex, localIndex & SECTION_BLOCKS_MASK);
+
+	return m_SectionPalettes[sectionIndex][paletteIndex];
+}
+
+
+
+inline uint8_t BlockTypeStorage::GetPaletteIndex(int sectionIndex, int sectionBlockIndex) const
+{
+	int bitsPerIndex = m_SectionBitsPerIndex[sectionIndex];
+	int bitOffset = sectionBlockIndex * bitsPerIndex;
+
+	uint8_t packedByte = m_SectionIndices[sectionIndex][bitOffset >> 3];
+	uint8_t indexMask = static_cast<uint8_t>((1U << bitsPerIndex) - 1U);
+
+	return static_cast<uint8_t>((packedByte >> (bitOffset & 7)) & indexMask);
+}
+
+
+
+inline void BlockTypeStorage::SetPaletteIndex(int sectionIndex, int sectionBlockIndex, uint8_t paletteIndex)
+{
+	int bitsPerIndex = m_SectionBitsPerIndex[sectionIndex];
+	int bitOffset = sectionBlockIndex * bitsPerIndex;
+
+	uint8_t& packedByte = m_SectionIndices[sectionIndex][bitOffset >> 3];
+	uint8_t indexMask = static_cast<uint8_t>(((1U << bitsPerIndex) - 1U) << (bitOffset & 7));
+
+	packedByte = static_cast<uint8_t>((packedByte & ~indexMask) | ((paletteIndex << (bitOffset & 7)) & indexMask));
+}
+
+
+
+inline int BlockTypeStorage::GetBitsPerIndexForPaletteSize(size_t paletteSize)
+{
+	if (paletteSize <= 1U)
+	{
+		return 0;
+	}
+	else if (paletteSize <= 2U)
+	{
+		return 1;
+	}
+	else if (paletteSize <= 4U)
+	{
+		return 2;
+	}
+	else if (paletteSize <= 16U)
+	{
+		return 4;
+	}
+
+	return MAXIMUM_BITS_PER_PALETTE_INDEX;
+}
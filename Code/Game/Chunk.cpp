@@ -1,36 +1,32 @@
 #include "Game/Chunk.hpp"
 #include "Game/BlockInfo.hpp"
+#include "Game/ChunkQuadIndexBuffer.hpp"
+
+#include <string.h>
 
 
 
 void ChunkProxy::CompressToRLEBuffer(uint8_t* rleBuffer, size_t& bufferSize)
 {
-	uint8_t currentBlockType = m_BlockTypes[0];
-	uint8_t currentBlockTypeCount = 0;
+	CompressBytesToRLEBuffer(m_BlockTypes, rleBuffer, bufferSize);
 
-	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
-	{
-		if (m_BlockTypes[blockIndex] == currentBlockType && currentBlockTypeCount < 255)
-		{
-			++currentBlockTypeCount;
-		}
-		else
-		{
-			rleBuffer[bufferSize] = currentBlockType;
-			++bufferSize;
-			rleBuffer[bufferSize] = currentBlockTypeCount;
-			++bufferSize;
+	rleBuffer[bufferSize] = HEIGHTMAP_SECTION_TAG;
+	++bufferSize;
+	memcpy(&rleBuffer[bufferSize], m_ColumnHeights, NUMBER_OF_BLOCKS_PER_LAYER);
+	bufferSize += NUMBER_OF_BLOCKS_PER_LAYER;
 
-			currentBlockType = m_BlockTypes[blockIndex];
-			currentBlockTypeCount = 1;
-		}
-	}
-	if (currentBlockTypeCount > 0)
+	if (m_HasInternalLight)
 	{
-		rleBuffer[bufferSize] = currentBlockType;
+		rleBuffer[bufferSize] = LIGHT_SECTION_TAG;
 		++bufferSize;
-		rleBuffer[bufferSize] = currentBlockTypeCount;
+		rleBuffer[bufferSize] = LIGHT_SECTION_VERSION;
 		++bufferSize;
+
+		uint32_t blockPropertiesChecksum = BlockDefinition::GetBlockPropertiesChecksum();
+		memcpy(&rleBuffer[bufferSize], &blockPropertiesChecksum, LIGHT_SECTION_CHECKSUM_SIZE);
+		bufferSize += LIGHT_SECTION_CHECKSUM_SIZE;
+
+		CompressBytesToRLEBuffer(m_PackedLight, rleBuffer, bufferSize);
 	}
 }
 
@@ -38,19 +34,35 @@ void ChunkProxy::CompressToRLEBuffer(uint8_t* rleBuffer, size_t& bufferSize)
 
 void ChunkProxy::DecompressFromRLEBuffer(const uint8_t* rleBuffer, size_t bufferSize)
 {
-	int blockIndex = 0;
+	size_t byteIndex = 0U;
+	DecompressBytesFromRLEBuffer(rleBuffer, bufferSize, byteIndex, m_BlockTypes);
 
-	for (size_t byteIndex = 0; byteIndex < bufferSize; byteIndex += 2U)
+	m_HasInternalLight = false;
+
+	if (byteIndex + HEIGHTMAP_SECTION_SIZE <= bufferSize && rleBuffer[byteIndex] == HEIGHTMAP_SECTION_TAG)
 	{
-		uint8_t currentBlockType = rleBuffer[byteIndex];
-		int currentBlockTypeCount = (int)rleBuffer[byteIndex + 1];
+		memcpy(m_ColumnHeights, &rleBuffer[byteIndex + 1U], NUMBER_OF_BLOCKS_PER_LAYER);
+		byteIndex += HEIGHTMAP_SECTION_SIZE;
 
-		for (int blockCount = 0; blockCount < currentBlockTypeCount; ++blockCount)
+		if (byteIndex + LIGHT_SECTION_HEADER_SIZE <= bufferSize && rleBuffer[byteIndex] == LIGHT_SECTION_TAG && rleBuffer[byteIndex + 1U] == LIGHT_SECTION_VERSION)
 		{
-			m_BlockTypes[blockIndex] = currentBlockType;
-			++blockIndex;
+			uint32_t blockPropertiesChecksum = 0U;
+			memcpy(&blockPropertiesChecksum, &rleBuffer[byteIndex + 2U], LIGHT_SECTION_CHECKSUM_SIZE);
+			if (blockPropertiesChecksum != BlockDefinition::GetBlockPropertiesChecksum())
+			{
+				return;
+			}
+
+			byteIndex += LIGHT_SECTION_HEADER_SIZE;
+
+			int numberOfLightBytes = DecompressBytesFromRLEBuffer(rleBuffer, bufferSize, byteIndex, m_PackedLight);
+			m_HasInternalLight = (numberOfLightBytes == NUMBER_OF_BLOCKS_PER_CHUNK);
 		}
 	}
+	else
+	{
+		CalculateColumnHeights();
+	}
 }
 
 
@@ -97,6 +109,10 @@ void ChunkProxy::PopulateFromPerlinNoise()
 				{
 					m_BlockTypes[localIndex] = BEDROCK_BLOCK;
 				}
+				else
+				{
+					m_BlockTypes[localIndex] = AIR_BLOCK;
+				}
 			}
 		}
 	}
@@ -122,6 +138,117 @@ void ChunkProxy::PopulateFromPerlinNoise()
 			}
 		}
 	}
+
+	CalculateColumnHeights();
+}
+
+
+
+void ChunkProxy::CalculateColumnHeights()
+{
+	for (int columnIndex = 0; columnIndex < NUMBER_OF_BLOCKS_PER_LAYER; ++columnIndex)
+	{
+		int columnHeight = NUMBER_OF_BLOCKS_Z;
+		while (columnHeight > 0 && !BlockDefinition::IsOpaque(m_BlockTypes[((columnHeight - 1) << BLOCK_BITS_PER_LAYER) + columnIndex]))
+		{
+			--columnHeight;
+		}
+
+		m_ColumnHeights[columnIndex] = static_cast<uint8_t>(columnHeight);
+	}
+}
+
+
+
+void ChunkProxy::CalculateInternalLight(std::vector<uint16_t>& lightPropagationQueue)
+{
+	memset(m_PackedLight, 0, sizeof(m_PackedLight));
+
+	lightPropagationQueue.clear();
+	for (int localIndex = 0; localIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++localIndex)
+	{
+		uint8_t currentBlockType = m_BlockTypes[localIndex];
+		if (BlockDefinition::IsEmissive(currentBlockType))
+		{
+			SetLightValue(localIndex, BLOCK_LIGHT_CHANNEL, BlockDefinition::GetIlluminationValue(currentBlockType));
+			lightPropagationQueue.push_back(static_cast<uint16_t>(localIndex));
+		}
+	}
+
+	PropagateInternalLight(BLOCK_LIGHT_CHANNEL, lightPropagationQueue);
+
+	lightPropagationQueue.clear();
+	for (int columnIndex = 0; columnIndex < NUMBER_OF_BLOCKS_PER_LAYER; ++columnIndex)
+	{
+		for (int blockIndexZ = NUMBER_OF_BLOCKS_Z - 1; blockIndexZ >= m_ColumnHeights[columnIndex]; --blockIndexZ)
+		{
+			int localIndex = (blockIndexZ << BLOCK_BITS_PER_LAYER) + columnIndex;
+			SetLightValue(localIndex, SKY_LIGHT_CHANNEL, SKY_LIGHT_VALUE);
+
+			if (ColumnNeighbourIsBelowSky(localIndex))
+			{
+				lightPropagationQueue.push_back(static_cast<uint16_t>(localIndex));
+			}
+		}
+	}
+
+	PropagateInternalLight(SKY_LIGHT_CHANNEL, lightPropagationQueue);
+
+	m_HasInternalLight = true;
+}
+
+
+
+void ChunkProxy::CompressBytesToRLEBuffer(const uint8_t* sourceBytes, uint8_t* rleBuffer, size_t& bufferSize)
+{
+	uint8_t currentByte = sourceBytes[0];
+	uint8_t currentByteCount = 0;
+
+	for (int byteIndex = 0; byteIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++byteIndex)
+	{
+		if (sourceBytes[byteIndex] == currentByte && currentByteCount < 255)
+		{
+			++currentByteCount;
+		}
+		else
+		{
+			rleBuffer[bufferSize] = currentByte;
+			++bufferSize;
+			rleBuffer[bufferSize] = currentByteCount;
+			++bufferSize;
+
+			currentByte = sourceBytes[byteIndex];
+			currentByteCount = 1;
+		}
+	}
+	if (currentByteCount > 0)
+	{
+		rleBuffer[bufferSize] = currentByte;
+		++bufferSize;
+		rleBuffer[bufferSize] = currentByteCount;
+		++bufferSize;
+	}
+}
+
+
+
+int ChunkProxy::DecompressBytesFromRLEBuffer(const uint8_t* rleBuffer, size_t bufferSize, size_t& byteIndex, uint8_t* destinationBytes)
+{
+	int destinationIndex = 0;
+
+	for (; byteIndex + 1U < bufferSize && destinationIndex < NUMBER_OF_BLOCKS_PER_CHUNK; byteIndex += 2U)
+	{
+		uint8_t currentByte = rleBuffer[byteIndex];
+		int currentByteCount = (int)rleBuffer[byteIndex + 1];
+
+		for (int byteCount = 0; byteCount < currentByteCount && destinationIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++byteCount)
+		{
+			destinationBytes[destinationIndex] = currentByte;
+			++destinationIndex;
+		}
+	}
+
+	return destinationIndex;
 }
 
 
@@ -141,20 +268,122 @@ int ChunkProxy::GenerateHeightValueForBlock(int blockX, int blockY)
 
 
 
+bool ChunkProxy::ColumnNeighbourIsBelowSky(int localIndex) const
+{
+	int columnIndex = localIndex & COLUMN_INDEX_MASK;
+	int blockX = localIndex & BLOCKS_X_MASK;
+	int blockY = (localIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK;
+	int blockZ = localIndex >> BLOCK_BITS_PER_LAYER;
+
+	if (blockX < BLOCKS_X_MASK && blockZ < m_ColumnHeights[columnIndex + 1])
+	{
+		return true;
+	}
+	if (blockX > 0 && blockZ < m_ColumnHeights[columnIndex - 1])
+	{
+		return true;
+	}
+	if (blockY < BLOCKS_Y_MASK && blockZ < m_ColumnHeights[columnIndex + NUMBER_OF_BLOCKS_X])
+	{
+		return true;
+	}
+	if (blockY > 0 && blockZ < m_ColumnHeights[columnIndex - NUMBER_OF_BLOCKS_X])
+	{
+		return true;
+	}
+
+	return false;
+}
+
+
+
+void ChunkProxy::PropagateInternalLight(uint8_t lightChannel, std::vector<uint16_t>& lightPropagationQueue)
+{
+	for (size_t queueIndex = 0U; queueIndex < lightPropagationQueue.size(); ++queueIndex)
+	{
+		int localIndex = lightPropagationQueue[queueIndex];
+
+		int propagatedLightValue = GetLightValue(localIndex, lightChannel) - 1;
+		if (propagatedLightValue <= 0)
+		{
+			continue;
+		}
+
+		int blockX = localIndex & BLOCKS_X_MASK;
+		int blockY = (localIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK;
+		int blockZ = localIndex >> BLOCK_BITS_PER_LAYER;
+
+		if (blockX < BLOCKS_X_MASK)
+		{
+			PropagateInternalLightToBlock(localIndex + 1, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+		if (blockX > 0)
+		{
+			PropagateInternalLightToBlock(localIndex - 1, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+		if (blockY < BLOCKS_Y_MASK)
+		{
+			PropagateInternalLightToBlock(localIndex + NUMBER_OF_BLOCKS_X, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+		if (blockY > 0)
+		{
+			PropagateInternalLightToBlock(localIndex - NUMBER_OF_BLOCKS_X, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+		if (blockZ < BLOCKS_Z_MASK)
+		{
+			PropagateInternalLightToBlock(localIndex + NUMBER_OF_BLOCKS_PER_LAYER, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+		if (blockZ > 0)
+		{
+			PropagateInternalLightToBlock(localIndex - NUMBER_OF_BLOCKS_PER_LAYER, lightChannel, propagatedLightValue, lightPropagationQueue);
+		}
+	}
+}
+
+
+
+void ChunkProxy::PropagateInternalLightToBlock(int localIndex, uint8_t lightChannel, int lightValue, std::vector<uint16_t>& lightPropagationQueue)
+{
+	if (BlockDefinition::IsOpaque(m_BlockTypes[localIndex]))
+	{
+		return;
+	}
+
+	if (GetLightValue(localIndex, lightChannel) < lightValue)
+	{
+		SetLightValue(localIndex, lightChannel, lightValue);
+		lightPropagationQueue.push_back(static_cast<uint16_t>(localIndex));
+	}
+}
+
+
+
 Chunk::Chunk() :
-m_ChunkCoordinates(IntVector2::ZERO),
-m_ChunkWorldMinimums(Vector3::ZERO),
-m_IsModified(false),
-m_ChunkMesh(new Mesh()),
-m_WaterMesh(new Mesh()),
+m_NorthernNeighbour(nullptr),
+m_SouthernNeighbour(nullptr),
 m_EasternNeighbour(nullptr),
 m_WesternNeighbour(nullptr),
-m_NorthernNeighbour(nullptr),
-m_SouthernNeighbour(nullptr)
+m_ModifiedSections(0U),
+m_SectionsInFlight(0U),
+m_IsPopulated(false),
+m_NeedsUrgentRebuild(false),
+m_MeshRevisionInFlight(0U),
+m_NumberOfMeshVertices(0U),
+m_NumberOfMeshIndices(0U),
+m_WaterMesh(new Mesh()),
+m_ChunkCoordinates(IntVector2::ZERO),
+m_ChunkWorldMinimums(Vector3::ZERO),
+m_ChunkSlotIndex(0U)
 {
-	for (int localIndex = 0; localIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++localIndex)
+	memset(m_PackedLight, 0, sizeof(m_PackedLight));
+	memset(m_ColumnHeights, 0, sizeof(m_ColumnHeights));
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
 	{
-		m_Blocks[localIndex] = Block(AIR_BLOCK);
+		m_SectionBlockTypes[sectionIndex] = AIR_BLOCK;
+		m_NumberOfSectionVertices[sectionIndex] = 0U;
+		m_NumberOfSectionIndices[sectionIndex] = 0U;
+		m_SectionMeshes[sectionIndex] = new Mesh();
 	}
 }
 
@@ -163,7 +392,11 @@ m_SouthernNeighbour(nullptr)
 Chunk::~Chunk()
 {
 	delete m_WaterMesh;
-	delete m_ChunkMesh;
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		delete m_SectionMeshes[sectionIndex];
+	}
 }
 
 
@@ -172,402 +405,271 @@ void Chunk::InitializeChunk(const IntVector2& chunkCoordinates)
 {
 	m_ChunkCoordinates = chunkCoordinates;
 	m_ChunkWorldMinimums = GetChunkWorldMinimumsForChunkCoordinates(chunkCoordinates);
-}
 
+	m_EasternNeighbour = nullptr;
+	m_WesternNeighbour = nullptr;
+	m_NorthernNeighbour = nullptr;
+	m_SouthernNeighbour = nullptr;
 
+	m_ModifiedSections = 0U;
+	m_SectionsInFlight = 0U;
+	m_IsPopulated = false;
+	m_NeedsUrgentRebuild = false;
+	m_MeshRevisionInFlight = 0U;
+	m_NumberOfMeshVertices = 0U;
+	m_NumberOfMeshIndices = 0U;
 
-ChunkProxy Chunk::GetChunkProxyFromChunk()
-{
-	ChunkProxy chunkProxy;
-	chunkProxy.m_ChunkCoordinates = m_ChunkCoordinates;
-	chunkProxy.m_IsValid = true;
+	memset(m_PackedLight, 0, sizeof(m_PackedLight));
 
-	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
 	{
-		chunkProxy.m_BlockTypes[blockIndex] = m_Blocks[blockIndex].GetType();
+		m_SectionBlockTypes[sectionIndex] = AIR_BLOCK;
+		m_NumberOfSectionVertices[sectionIndex] = 0U;
+		m_NumberOfSectionIndices[sectionIndex] = 0U;
+		m_SectionMeshes[sectionIndex]->m_RenderInstructions.clear();
 	}
 
-	return chunkProxy;
+	m_WaterMesh->m_RenderInstructions.clear();
 }
 
 
 
-void Chunk::PopulateChunkFromChunkProxy(const ChunkProxy& chunkProxy)
+void Chunk::PopulateChunkProxyFromChunk(ChunkProxy& chunkProxy) const
 {
-	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
-	{
-		m_Blocks[blockIndex].SetType(chunkProxy.m_BlockTypes[blockIndex]);
-	}
+	chunkProxy.m_ChunkCoordinates = m_ChunkCoordinates;
+	chunkProxy.m_HasInternalLight = false;
+	chunkProxy.m_IsValid = true;
 
-	m_IsModified = true;
+	m_BlockTypes.CopyToBlockTypes(chunkProxy.m_BlockTypes);
+	memcpy(chunkProxy.m_ColumnHeights, m_ColumnHeights, sizeof(m_ColumnHeights));
 }
 
 
 
-void Chunk::RebuildChunkMesh()
+void Chunk::PopulateChunkFromChunkProxy(const ChunkProxy& chunkProxy)
 {
-	std::vector<Vertex3D> chunkVertices;
-	std::vector<uint32_t> chunkIndices;
-	
-	Vertex3D chunkVertex;
-	chunkVertex.m_Color = RGBA::WHITE;
+	m_BlockTypes.CopyFromBlockTypes(chunkProxy.m_BlockTypes);
+	memcpy(m_ColumnHeights, chunkProxy.m_ColumnHeights, sizeof(m_ColumnHeights));
+	memcpy(m_PackedLight, chunkProxy.m_PackedLight, sizeof(m_PackedLight));
 
-	Vector3 eastDirection = Vector3::X_AXIS;
-	Vector3 westDirection = eastDirection.GetNegatedVector3();
+	UpdateAllSectionBlockTypes();
 
-	Vector3 northDirection = Vector3::Y_AXIS;
-	Vector3 southDirection = northDirection.GetNegatedVector3();
+	m_ModifiedSections = ALL_SECTIONS_MASK;
+	m_IsPopulated = true;
+}
 
-	Vector3 upDirection = Vector3::Z_AXIS;
-	Vector3 downDirection = upDirection.GetNegatedVector3();
 
-	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
-	{
-		Block currentBlock = m_Blocks[blockIndex];
 
-		if (currentBlock.IsVisible() && currentBlock.IsOpaque())
+void Chunk::UpdateColumnHeightForLocalIndex(int localIndex)
+{
+	int columnIndex = GetColumnIndexForLocalIndex(localIndex);
+	int blockZ = GetLayerIndexforLocalIndex(localIndex);
+
+	if (BlockDefinition::IsOpaque(GetBlockType(localIndex)))
+	{
+		if (blockZ >= m_ColumnHeights[columnIndex])
 		{
-			IntVector3 blockLocalCoordinates = GetLocalCoordinatesForLocalIndex(blockIndex);
-			IntVector3 blockWorldCoordinates = GetBlockWorldCoordinatesForLocalCoordinates(blockLocalCoordinates);
+			m_ColumnHeights[columnIndex] = static_cast<uint8_t>(blockZ + 1);
+		}
 
-			Vector3 blockMinimums = GetBlockMinimumsForBlockCoordinates(blockWorldCoordinates);
-			Vector3 blockMaximums = blockMinimums + Vector3::ONE;
+		return;
+	}
 
-			if (EasternNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-				
-				int lightValue = GetLightValueForEasternNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = northDirection;
-				chunkVertex.m_Bitangent = upDirection;
-				chunkVertex.m_Normal = eastDirection;
-
-				AABB2 eastFace = currentBlock.GetSideFaceTextureAABB();
-				Vector2 eastFaceMin = eastFace.minimums;
-				Vector2 eastFaceMax = eastFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(eastFaceMax.X, eastFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(eastFaceMax.X, eastFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(eastFaceMin.X, eastFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(eastFaceMin.X, eastFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
+	if (blockZ + 1 != m_ColumnHeights[columnIndex])
+	{
+		return;
+	}
 
-			if (WesternNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-
-				int lightValue = GetLightValueForWesternNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = southDirection;
-				chunkVertex.m_Bitangent = upDirection;
-				chunkVertex.m_Normal = westDirection;
-
-				AABB2 westFace = currentBlock.GetSideFaceTextureAABB();
-				Vector2 westFaceMin = westFace.minimums;
-				Vector2 westFaceMax = westFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(westFaceMin.X, westFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(westFaceMax.X, westFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(westFaceMax.X, westFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(westFaceMin.X, westFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
+	int columnHeight = blockZ;
+	while (columnHeight > 0 && !BlockDefinition::IsOpaque(GetBlockType(((columnHeight - 1) << BLOCK_BITS_PER_LAYER) + columnIndex)))
+	{
+		--columnHeight;
+	}
 
-			if (NorthernNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-
-				int lightValue = GetLightValueForNorthernNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = westDirection;
-				chunkVertex.m_Bitangent = upDirection;
-				chunkVertex.m_Normal = northDirection;
-
-				AABB2 northFace = currentBlock.GetSideFaceTextureAABB();
-				Vector2 northFaceMin = northFace.minimums;
-				Vector2 northFaceMax = northFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(northFaceMin.X, northFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(northFaceMax.X, northFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(northFaceMax.X, northFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(northFaceMin.X, northFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
+	m_ColumnHeights[columnIndex] = static_cast<uint8_t>(columnHeight);
+}
 
-			if (SouthernNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-
-				int lightValue = GetLightValueForSouthernNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = eastDirection;
-				chunkVertex.m_Bitangent = upDirection;
-				chunkVertex.m_Normal = southDirection;
-
-				AABB2 southFace = currentBlock.GetSideFaceTextureAABB();
-				Vector2 southFaceMin = southFace.minimums;
-				Vector2 southFaceMax = southFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(southFaceMax.X, southFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(southFaceMax.X, southFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(southFaceMin.X, southFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(southFaceMin.X, southFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
 
-			if (AboveNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-
-				int lightValue = GetLightValueForAboveNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = eastDirection;
-				chunkVertex.m_Bitangent = northDirection;
-				chunkVertex.m_Normal = upDirection;
-
-				AABB2 topFace = currentBlock.GetTopFaceTextureAABB();
-				Vector2 topFaceMin = topFace.minimums;
-				Vector2 topFaceMax = topFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(topFaceMax.X, topFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(topFaceMax.X, topFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(topFaceMin.X, topFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMaximums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(topFaceMin.X, topFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
 
-			if (BelowNeighbourDoesNotExist(blockIndex))
-			{
-				size_t previousIndex = chunkVertices.size();
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 1);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 0);
-				chunkIndices.push_back(previousIndex + 2);
-				chunkIndices.push_back(previousIndex + 3);
-
-				int lightValue = GetLightValueForBelowNeighbour(blockIndex);
-				float light = static_cast<float>(lightValue);
-				float lightFraction = RangeMap(light, 0.0f, 15.0f, 50.0f, 255.0f);
-				unsigned char newLight = static_cast<unsigned char>(lightFraction);
-				chunkVertex.m_Color = RGBA(newLight, newLight, newLight, 255);
-
-				chunkVertex.m_Tangent = westDirection;
-				chunkVertex.m_Bitangent = northDirection;
-				chunkVertex.m_Normal = downDirection;
-
-				AABB2 bottomFace = currentBlock.GetBottomFaceTextureAABB();
-				Vector2 bottomFaceMin = bottomFace.minimums;
-				Vector2 bottomFaceMax = bottomFace.maximums;
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(bottomFaceMin.X, bottomFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(bottomFaceMax.X, bottomFaceMax.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(bottomFaceMax.X, bottomFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-
-				chunkVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMinimums.Z);
-				chunkVertex.m_TextureCoordinates = Vector2(bottomFaceMin.X, bottomFaceMin.Y);
-				chunkVertices.push_back(chunkVertex);
-			}
+void Chunk::UpdateSectionBlockType(int sectionIndex)
+{
+	int firstBlockIndex = sectionIndex << BLOCK_BITS_PER_SECTION;
+	uint8_t sectionBlockType = m_BlockTypes.GetBlockType(firstBlockIndex);
+
+	for (int blockIndex = firstBlockIndex + 1; blockIndex < firstBlockIndex + NUMBER_OF_BLOCKS_PER_SECTION; ++blockIndex)
+	{
+		if (m_BlockTypes.GetBlockType(blockIndex) != sectionBlockType)
+		{
+			sectionBlockType = INVALID_BLOCK;
+			break;
 		}
 	}
 
-	m_ChunkMesh->WriteToMesh(chunkVertices.data(), chunkIndices.data(), chunkVertices.size(), chunkIndices.size());
-
-	m_ChunkMesh->m_RenderInstructions.clear();
-	m_ChunkMesh->AddRenderInstruction(chunkVertices.size(), chunkIndices.size(), TRIANGLES_PRIMITIVE);
+	m_SectionBlockTypes[sectionIndex] = sectionBlockType;
 }
 
 
 
-void Chunk::RebuildWaterMesh()
+void Chunk::UpdateAllSectionBlockTypes()
 {
-	std::vector<Vertex3D> waterVertices;
-	std::vector<uint32_t> waterIndices;
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		UpdateSectionBlockType(sectionIndex);
+	}
+}
 
-	Vertex3D waterVertex;
-	waterVertex.m_Color = RGBA(0, 191, 255, 255);
 
-	waterVertex.m_Tangent = Vector3::X_AXIS;
-	waterVertex.m_Bitangent = Vector3::Y_AXIS;
-	waterVertex.m_Normal = Vector3::Z_AXIS;
 
-	const float OFFSET_HEIGHT = 0.25f * BLOCK_HEIGHT;
-	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
+void Chunk::PopulateMeshSnapshotFromChunk(ChunkMeshSnapshot& meshSnapshot) const
+{
+	meshSnapshot.m_ChunkCoordinates = m_ChunkCoordinates;
+	meshSnapshot.m_ChunkWorldMinimums = m_ChunkWorldMinimums;
+
+	m_BlockTypes.CopyToBlockTypes(meshSnapshot.m_BlockTypes);
+	memcpy(meshSnapshot.m_PackedLight, m_PackedLight, sizeof(m_PackedLight));
+	memcpy(meshSnapshot.m_SectionBlockTypes, m_SectionBlockTypes, sizeof(m_SectionBlockTypes));
+
+	const Chunk* borderChunks[NUMBER_OF_CHUNK_BORDERS] = { m_EasternNeighbour, m_WesternNeighbour, m_NorthernNeighbour, m_SouthernNeighbour };
+	for (int borderIndex = 0; borderIndex < NUMBER_OF_CHUNK_BORDERS; ++borderIndex)
 	{
-		Block currentBlock = m_Blocks[blockIndex];
-		if (currentBlock.IsVisible() && !currentBlock.IsOpaque())
+		const Chunk* borderChunk = borderChunks[borderIndex];
+		meshSnapshot.m_BorderIsConnected[borderIndex] = (borderChunk != nullptr);
+
+		if (borderChunk == nullptr)
 		{
-			BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-			BlockInfo aboveBlockInfo = currentBlockInfo.GetAboveNeighbour();
-			
-			int aboveBlockIndex = aboveBlockInfo.GetBlockIndex();
-			if (m_Blocks[aboveBlockIndex].GetType() == AIR_BLOCK)
+			continue;
+		}
+
+		uint8_t* borderBlockTypes = meshSnapshot.m_BorderBlockTypes[borderIndex];
+		uint8_t* borderPackedLight = meshSnapshot.m_BorderPackedLight[borderIndex];
+		for (int blockZ = 0; blockZ < NUMBER_OF_BLOCKS_Z; ++blockZ)
+		{
+			for (int borderOffset = 0; borderOffset < NUMBER_OF_BLOCKS_X; ++borderOffset)
 			{
-				size_t previousIndex = waterVertices.size();
-				waterIndices.push_back(previousIndex + 0);
-				waterIndices.push_back(previousIndex + 1);
-				waterIndices.push_back(previousIndex + 2);
-				waterIndices.push_back(previousIndex + 0);
-				waterIndices.push_back(previousIndex + 2);
-				waterIndices.push_back(previousIndex + 3);
-
-				IntVector3 blockLocalCoordinates = GetLocalCoordinatesForLocalIndex(blockIndex);
-				IntVector3 blockWorldCoordinates = GetBlockWorldCoordinatesForLocalCoordinates(blockLocalCoordinates);
-
-				Vector3 blockMinimums = GetBlockMinimumsForBlockCoordinates(blockWorldCoordinates);
-				Vector3 blockMaximums = blockMinimums + Vector3::ONE;
-
-				AABB2 topFace = currentBlock.GetTopFaceTextureAABB();
-				Vector2 topFaceMin = topFace.minimums;
-				Vector2 topFaceMax = topFace.maximums;
-
-				waterVertex.m_Position = Vector3(blockMaximums.X, blockMinimums.Y, blockMaximums.Z - OFFSET_HEIGHT);
-				waterVertex.m_TextureCoordinates = Vector2(topFaceMax.X, topFaceMax.Y);
-				waterVertices.push_back(waterVertex);
-
-				waterVertex.m_Position = Vector3(blockMaximums.X, blockMaximums.Y, blockMaximums.Z - OFFSET_HEIGHT);
-				waterVertex.m_TextureCoordinates = Vector2(topFaceMax.X, topFaceMin.Y);
-				waterVertices.push_back(waterVertex);
-
-				waterVertex.m_Position = Vector3(blockMinimums.X, blockMaximums.Y, blockMaximums.Z - OFFSET_HEIGHT);
-				waterVertex.m_TextureCoordinates = Vector2(topFaceMin.X, topFaceMin.Y);
-				waterVertices.push_back(waterVertex);
-
-				waterVertex.m_Position = Vector3(blockMinimums.X, blockMinimums.Y, blockMaximums.Z - OFFSET_HEIGHT);
-				waterVertex.m_TextureCoordinates = Vector2(topFaceMin.X, topFaceMax.Y);
-				waterVertices.push_back(waterVertex);
+				IntVector3 neighbourLocalCoordinates;
+				switch (borderIndex)
+				{
+				case EASTERN_BORDER:
+					neighbourLocalCoordinates = IntVector3(0, borderOffset, blockZ);
+					break;
+
+				case WESTERN_BORDER:
+					neighbourLocalCoordinates = IntVector3(BLOCKS_X_MASK, borderOffset, blockZ);
+					break;
+
+				case NORTHERN_BORDER:
+					neighbourLocalCoordinates = IntVector3(borderOffset, 0, blockZ);
+					break;
+
+				default:
+					neighbourLocalCoordinates = IntVector3(borderOffset, BLOCKS_Y_MASK, blockZ);
+					break;
+				}
+
+				int neighbourIndex = GetLocalIndexForLocalCoordinates(neighbourLocalCoordinates);
+				int borderBlockIndex = ChunkMeshSnapshot::GetBorderIndexForLocalCoordinates(borderOffset, blockZ);
+				borderBlockTypes[borderBlockIndex] = borderChunk->GetBlockType(neighbourIndex);
+				borderPackedLight[borderBlockIndex] = borderChunk->GetPackedLight(neighbourIndex);
 			}
 		}
 	}
+}
 
-	m_WaterMesh->WriteToMesh(waterVertices.data(), waterIndices.data(), waterVertices.size(), waterIndices.size());
 
-	m_WaterMesh->m_RenderInstructions.clear();
-	m_WaterMesh->AddRenderInstruction(waterVertices.size(), waterIndices.size(), TRIANGLES_PRIMITIVE);
+
+void Chunk::WriteMeshFromSnapshot(const ChunkMeshSnapshot& meshSnapshot)
+{
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		if ((meshSnapshot.m_SectionsToBuild & (1U << sectionIndex)) == 0U)
+		{
+			continue;
+		}
+
+		m_NumberOfMeshVertices -= m_NumberOfSectionVertices[sectionIndex];
+		m_NumberOfMeshIndices -= m_NumberOfSectionIndices[sectionIndex];
+
+		m_NumberOfSectionVertices[sectionIndex] = meshSnapshot.m_SectionVertices[sectionIndex].size();
+		m_NumberOfSectionIndices[sectionIndex] = WriteQuadVerticesToMesh(m_SectionMeshes[sectionIndex], meshSnapshot.m_SectionVertices[sectionIndex]);
+
+		m_NumberOfMeshVertices += m_NumberOfSectionVertices[sectionIndex];
+		m_NumberOfMeshIndices += m_NumberOfSectionIndices[sectionIndex];
+	}
+
+	WriteQuadVerticesToMesh(m_WaterMesh, meshSnapshot.m_WaterVertices);
 }
 
 
 
-void Chunk::RenderChunk(Material* chunkMaterial) const
+size_t Chunk::WriteQuadVerticesToMesh(Mesh* quadMesh, const std::vector<Vertex3D>& quadVertices)
 {
-	AdvancedRenderer::SingletonInstance()->DrawMeshWithVAO(m_ChunkMesh, chunkMaterial);
+	size_t numberOfVertices = quadVertices.size();
+	size_t numberOfIndices = ChunkQuadIndexBuffer::GetNumberOfIndicesForVertices(numberOfVertices);
+
+	quadMesh->WriteToMesh(quadVertices.data(), ChunkQuadIndexBuffer::s_QuadIndices.data(), numberOfVertices, numberOfIndices);
+
+	quadMesh->m_RenderInstructions.clear();
+	quadMesh->AddRenderInstruction(numberOfVertices, numberOfIndices, TRIANGLES_PRIMITIVE);
+
+	return numberOfIndices;
 }
 
 
 
-void Chunk::RenderWater(Material* waterMaterial) const
+void Chunk::BuildExposedFacesFromBlockInfo(ChunkMeshScratchArena& scratchArena)
 {
-	AdvancedRenderer::SingletonInstance()->DrawMeshWithVAO(m_WaterMesh, waterMaterial);
+	for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+	{
+		memset(scratchArena.GetExposedFaceRows(blockFace), 0, NUMBER_OF_BLOCK_ROWS * sizeof(uint16_t));
+	}
+
+	uint16_t* easternRows = scratchArena.GetExposedFaceRows(EAST_FACE);
+	uint16_t* westernRows = scratchArena.GetExposedFaceRows(WEST_FACE);
+	uint16_t* northernRows = scratchArena.GetExposedFaceRows(NORTH_FACE);
+	uint16_t* southernRows = scratchArena.GetExposedFaceRows(SOUTH_FACE);
+	uint16_t* topRows = scratchArena.GetExposedFaceRows(TOP_FACE);
+	uint16_t* bottomRows = scratchArena.GetExposedFaceRows(BOTTOM_FACE);
+
+	for (int blockIndex = 0; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++blockIndex)
+	{
+		Block currentBlock = GetBlock(blockIndex);
+
+		if (currentBlock.IsVisible() && currentBlock.IsOpaque())
+		{
+			int rowIndex = blockIndex >> BLOCK_BITS_X;
+			uint16_t blockBit = static_cast<uint16_t>(1U << (blockIndex & BLOCKS_X_MASK));
+
+			if (EasternNeighbourDoesNotExist(blockIndex))
+			{
+				easternRows[rowIndex] |= blockBit;
+			}
+
+			if (WesternNeighbourDoesNotExist(blockIndex))
+			{
+				westernRows[rowIndex] |= blockBit;
+			}
+
+			if (NorthernNeighbourDoesNotExist(blockIndex))
+			{
+				northernRows[rowIndex] |= blockBit;
+			}
+
+			if (SouthernNeighbourDoesNotExist(blockIndex))
+			{
+				southernRows[rowIndex] |= blockBit;
+			}
+
+			if (AboveNeighbourDoesNotExist(blockIndex))
+			{
+				topRows[rowIndex] |= blockBit;
+			}
+
+			if (BelowNeighbourDoesNotExist(blockIndex))
+			{
+				bottomRows[rowIndex] |= blockBit;
+			}
+		}
+	}
 }
 
 
@@ -583,7 +685,7 @@ inline bool Chunk::EasternNeighbourDoesNotExist(int blockIndex)
 	{
 		int easternBlockIndex = easternBlockInfo.GetBlockIndex();
 
-		if (easternBlockChunk->m_Blocks[easternBlockIndex].IsOpaque())
+		if (easternBlockChunk->GetBlock(easternBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -609,7 +711,7 @@ inline bool Chunk::WesternNeighbourDoesNotExist(int blockIndex)
 	{
 		int westernBlockIndex = westernBlockInfo.GetBlockIndex();
 
-		if (westernBlockChunk->m_Blocks[westernBlockIndex].IsOpaque())
+		if (westernBlockChunk->GetBlock(westernBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -635,7 +737,7 @@ inline bool Chunk::NorthernNeighbourDoesNotExist(int blockIndex)
 	{
 		int northernBlockIndex = northernBlockInfo.GetBlockIndex();
 
-		if (northernBlockChunk->m_Blocks[northernBlockIndex].IsOpaque())
+		if (northernBlockChunk->GetBlock(northernBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -661,7 +763,7 @@ inline bool Chunk::SouthernNeighbourDoesNotExist(int blockIndex)
 	{
 		int southernBlockIndex = southernBlockInfo.GetBlockIndex();
 
-		if (southernBlockChunk->m_Blocks[southernBlockIndex].IsOpaque())
+		if (southernBlockChunk->GetBlock(southernBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -687,7 +789,7 @@ inline bool Chunk::AboveNeighbourDoesNotExist(int blockIndex)
 	{
 		int aboveBlockIndex = aboveBlockInfo.GetBlockIndex();
 
-		if (aboveBlockChunk->m_Blocks[aboveBlockIndex].IsOpaque())
+		if (aboveBlockChunk->GetBlock(aboveBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -713,7 +815,7 @@ inline bool Chunk::BelowNeighbourDoesNotExist(int blockIndex)
 	{
 		int belowBlockIndex = belowBlockInfo.GetBlockIndex();
 
-		if (belowBlockChunk->m_Blocks[belowBlockIndex].IsOpaque())
+		if (belowBlockChunk->GetBlock(belowBlockIndex).IsOpaque())
 		{
 			return false;
 		}
@@ -726,66 +828,28 @@ inline bool Chunk::BelowNeighbourDoesNotExist(int blockIndex)
 	return true;
 }
 
-int Chunk::GetLightValueForEasternNeighbour(int blockIndex)
-{
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo easternBlockInfo = currentBlockInfo.GetEasternNeighbour();
-	Block* easternBlock = easternBlockInfo.GetBlock();
-
-	return easternBlock->GetLightValue();
-}
-
-
-
-int Chunk::GetLightValueForWesternNeighbour(int blockIndex)
-{
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo westernBlockInfo = currentBlockInfo.GetWesternNeighbour();
-	Block* westernBlock = westernBlockInfo.GetBlock();
-
-	return westernBlock->GetLightValue();
-}
-
-
-
-int Chunk::GetLightValueForNorthernNeighbour(int blockIndex)
-{
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo northernBlockInfo = currentBlockInfo.GetNorthernNeighbour();
-	Block* northernBlock = northernBlockInfo.GetBlock();
-
-	return northernBlock->GetLightValue();
-}
 
 
-
-int Chunk::GetLightValueForSouthernNeighbour(int blockIndex)
+void Chunk::RenderChunk(Material* chunkMaterial) const
 {
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo southernBlockInfo = currentBlockInfo.GetSouthernNeighbour();
-	Block* southernBlock = southernBlockInfo.GetBlock();
+	Matrix4 modelMatrix = AdvancedRenderer::SingletonInstance()->GetModelMatrix(Vector3::ONE, EulerAngles::ZERO, m_ChunkWorldMinimums);
+	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(modelMatrix);
 
-	return southernBlock->GetLightValue();
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		if (m_NumberOfSectionVertices[sectionIndex] > 0U)
+		{
+			AdvancedRenderer::SingletonInstance()->DrawMeshWithVAO(m_SectionMeshes[sectionIndex], chunkMaterial);
+		}
+	}
 }
 
 
 
-int Chunk::GetLightValueForAboveNeighbour(int blockIndex)
+void Chunk::RenderWater(Material* waterMaterial) const
 {
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo aboveBlockInfo = currentBlockInfo.GetAboveNeighbour();
-	Block* aboveBlock = aboveBlockInfo.GetBlock();
+	Matrix4 modelMatrix = AdvancedRenderer::SingletonInstance()->GetModelMatrix(Vector3::ONE, EulerAngles::ZERO, m_ChunkWorldMinimums);
+	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(modelMatrix);
 
-	return aboveBlock->GetLightValue();
+	AdvancedRenderer::SingletonInstance()->DrawMeshWithVAO(m_WaterMesh, waterMaterial);
 }
-
-
-
-int Chunk::GetLightValueForBelowNeighbour(int blockIndex)
-{
-	BlockInfo currentBlockInfo = BlockInfo(this, blockIndex);
-	BlockInfo belowBlockInfo = currentBlockInfo.GetBelowNeighbour();
-	Block* belowBlock = belowBlockInfo.GetBlock();
-
-	return belowBlock->GetLightValue();
-}
\ No newline at end of file
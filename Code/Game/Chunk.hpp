@@ -2,10 +2,21 @@
 
 #include "Game/GameCommons.hpp"
 #include "Game/Block.hpp"
+#include "Game/BlockTypeStorage.hpp"
+#include "Game/ChunkMeshSnapshot.hpp"
 
 
 
 const int GROUND_HEIGHT = 70;
+const int COLUMN_INDEX_MASK = NUMBER_OF_BLOCKS_PER_LAYER - 1;
+const uint8_t HEIGHTMAP_SECTION_TAG = 'H';
+const size_t HEIGHTMAP_SECTION_SIZE = 1U + NUMBER_OF_BLOCKS_PER_LAYER;
+const uint8_t LIGHT_SECTION_TAG = 'L';
+const uint8_t LIGHT_SECTION_VERSION = 2U;
+const size_t LIGHT_SECTION_CHECKSUM_SIZE = sizeof(uint32_t);
+const size_t LIGHT_SECTION_HEADER_SIZE = 2U + LIGHT_SECTION_CHECKSUM_SIZE;
+const size_t MAXIMUM_LIGHT_SECTION_SIZE = LIGHT_SECTION_HEADER_SIZE + (NUMBER_OF_BLOCKS_PER_CHUNK * 2U);
+const size_t MAXIMUM_RLE_BUFFER_SIZE = (NUMBER_OF_BLOCKS_PER_CHUNK * 2U) + HEIGHTMAP_SECTION_SIZE + MAXIMUM_LIGHT_SECTION_SIZE;
 
 
 
@@ -13,6 +24,7 @@ class ChunkProxy
 {
 public:
 	ChunkProxy() :
+	m_HasInternalLight(false),
 	m_IsValid(false)
 	{
 		
@@ -22,19 +34,51 @@ public:
 	void DecompressFromRLEBuffer(const uint8_t* rleBuffer, size_t bufferSize);
 
 	void PopulateFromPerlinNoise();
+	void CalculateColumnHeights();
+	void CalculateInternalLight(std::vector<uint16_t>& lightPropagationQueue);
 
 private:
+	static void CompressBytesToRLEBuffer(const uint8_t* sourceBytes, uint8_t* rleBuffer, size_t& bufferSize);
+	static int DecompressBytesFromRLEBuffer(const uint8_t* rleBuffer, size_t bufferSize, size_t& byteIndex, uint8_t* destinationBytes);
+
 	int GenerateHeightValueForBlock(int blockX, int blockY);
 
+	bool ColumnNeighbourIsBelowSky(int localIndex) const;
+	void PropagateInternalLight(uint8_t lightChannel, std::vector<uint16_t>& lightPropagationQueue);
+	void PropagateInternalLightToBlock(int localIndex, uint8_t lightChannel, int lightValue, std::vector<uint16_t>& lightPropagationQueue);
+
+	int GetLightValue(int localIndex, uint8_t lightChannel) const;
+	void SetLightValue(int localIndex, uint8_t lightChannel, int lightValue);
+
 public:
 	IntVector2 m_ChunkCoordinates;
 
 	uint8_t m_BlockTypes[NUMBER_OF_BLOCKS_PER_CHUNK];
+	uint8_t m_ColumnHeights[NUMBER_OF_BLOCKS_PER_LAYER];
+	uint8_t m_PackedLight[NUMBER_OF_BLOCKS_PER_CHUNK];
+	bool m_HasInternalLight;
 	bool m_IsValid;
 };
 
 
 
+inline int ChunkProxy::GetLightValue(int localIndex, uint8_t lightChannel) const
+{
+	return static_cast<int>((m_PackedLight[localIndex] >> (lightChannel * LIGHT_CHANNEL_BITS)) & LIGHT_CHANNEL_MASK);
+}
+
+
+
+inline void ChunkProxy::SetLightValue(int localIndex, uint8_t lightChannel, int lightValue)
+{
+	int channelShift = lightChannel * LIGHT_CHANNEL_BITS;
+
+	ClearBits(m_PackedLight[localIndex], static_cast<unsigned char>(LIGHT_CHANNEL_MASK << channelShift));
+	SetBits(m_PackedLight[localIndex], static_cast<unsigned char>(lightValue << channelShift));
+}
+
+
+
 class Chunk
 {
 public:
@@ -43,25 +87,67 @@ public:
 
 	void InitializeChunk(const IntVector2& chunkCoordinates);
 
-	ChunkProxy GetChunkProxyFromChunk();
+	void PopulateChunkProxyFromChunk(ChunkProxy& chunkProxy) const;
 	void PopulateChunkFromChunkProxy(const ChunkProxy& chunkProxy);
 	
-	void RebuildChunkMesh();
-	void RebuildWaterMesh();
+	void PopulateMeshSnapshotFromChunk(ChunkMeshSnapshot& meshSnapshot) const;
+	void WriteMeshFromSnapshot(const ChunkMeshSnapshot& meshSnapshot);
+
+	Block GetBlock(int localIndex) const;
+	uint8_t GetBlockType(int localIndex) const;
+	void SetBlockType(int localIndex, uint8_t blockType);
+
+	uint8_t GetPackedLight(int localIndex) const;
+	int GetLightValue(int localIndex, uint8_t lightChannel) const;
+	void SetLightValue(int localIndex, uint8_t lightChannel, int lightValue);
+	bool IsSky(int localIndex) const;
+
+	bool UsesPalettedBlockStorage() const;
+	void SetUsesPalettedBlockStorage(bool usesPalettedBlockStorage);
+	size_t GetNumberOfBlockTypeBytes() const;
 
 	void RenderChunk(Material* chunkMaterial) const;
 	void RenderWater(Material* waterMaterial) const;
 
 	bool IsModified();
 	void SetModified(bool modified);
+	uint8_t GetModifiedSections();
+	void MarkSectionModified(int sectionIndex);
+	void MarkSectionsModifiedForLocalIndex(int localIndex);
+	void MarkBlockTypeAsChanged(int localIndex);
+
+	int GetColumnHeight(int columnIndex) const;
+	void UpdateColumnHeightForLocalIndex(int localIndex);
+
+	uint8_t GetSectionBlockType(int sectionIndex) const;
+	void UpdateSectionBlockType(int sectionIndex);
+	void UpdateAllSectionBlockTypes();
+
+	bool IsPopulated();
+
+	bool NeedsUrgentRebuild();
+	void SetNeedsUrgentRebuild(bool needsUrgentRebuild);
+
+	bool MeshIsInFlight();
+	uint32_t GetMeshRevisionInFlight();
+	void SetMeshRevisionInFlight(uint32_t meshRevision);
+	uint8_t GetSectionsInFlight();
+	void SetSectionsInFlight(uint8_t sectionsInFlight);
+
+	size_t GetNumberOfMeshVertices();
+	size_t GetNumberOfMeshIndices();
 
 	IntVector2 GetChunkCoordinates();
 	Vector3 GetChunkWorldMinimums();
+	size_t GetChunkSlotIndex() const;
+	void SetChunkSlotIndex(size_t chunkSlotIndex);
 	int GetLocalIndexForBlockWorldCoordinates(const Vector3& blockWorldCoordinates) const;
 
 	IntVector2 GetLocalIndexRangeForLayerIndex(int layerIndex) const;
 	int GetLayerIndexforLocalIndex(int localIndex) const;
 	int GetLayerIndexforLocalCoordinates(const IntVector3& localCoordinates) const;
+	int GetSectionIndexForLocalIndex(int localIndex) const;
+	int GetColumnIndexForLocalIndex(int localIndex) const;
 
 	IntVector3 GetLocalCoordinatesForLocalIndex(int localIndex) const;
 	int GetLocalIndexForLocalCoordinates(const IntVector3& localCoordinates) const;
@@ -71,7 +157,13 @@ public:
 	Vector3 GetBlockMinimumsForBlockCoordinates(const IntVector3& blockCoordinates) const;
 
 	Vector3 GetChunkWorldMinimumsForChunkCoordinates(const IntVector2& chunkCoordinates) const;
-	
+	static uint32_t HashChunkCoordinates(const IntVector2& chunkCoordinates);
+
+	size_t WriteQuadVerticesToMesh(Mesh* quadMesh, const std::vector<Vertex3D>& quadVertices);
+
+	void BuildExposedFacesFromBlockInfo(ChunkMeshScratchArena& scratchArena);
+
+private:
 	bool EasternNeighbourDoesNotExist(int blockIndex);
 	bool WesternNeighbourDoesNotExist(int blockIndex);
 
@@ -81,44 +173,245 @@ public:
 	bool AboveNeighbourDoesNotExist(int blockIndex);
 	bool BelowNeighbourDoesNotExist(int blockIndex);
 
-	int GetLightValueForEasternNeighbour(int blockIndex);
-	int GetLightValueForWesternNeighbour(int blockIndex);
-
-	int GetLightValueForNorthernNeighbour(int blockIndex);
-	int GetLightValueForSouthernNeighbour(int blockIndex);
-
-	int GetLightValueForAboveNeighbour(int blockIndex);
-	int GetLightValueForBelowNeighbour(int blockIndex);
-
 public:
 	Chunk* m_NorthernNeighbour;
 	Chunk* m_SouthernNeighbour;
 	Chunk* m_EasternNeighbour;
 	Chunk* m_WesternNeighbour;
 
-	Block m_Blocks[NUMBER_OF_BLOCKS_PER_CHUNK];
-
 private:
-	bool m_IsModified;
-	Mesh* m_ChunkMesh;
+	BlockTypeStorage m_BlockTypes;
+	uint8_t m_PackedLight[NUMBER_OF_BLOCKS_PER_CHUNK];
+	uint8_t m_ColumnHeights[NUMBER_OF_BLOCKS_PER_LAYER];
+
+	uint8_t m_ModifiedSections;
+	uint8_t m_SectionsInFlight;
+	bool m_IsPopulated;
+	bool m_NeedsUrgentRebuild;
+	uint32_t m_MeshRevisionInFlight;
+	size_t m_NumberOfMeshVertices;
+	size_t m_NumberOfMeshIndices;
+	uint8_t m_SectionBlockTypes[NUMBER_OF_SECTIONS];
+	size_t m_NumberOfSectionVertices[NUMBER_OF_SECTIONS];
+	size_t m_NumberOfSectionIndices[NUMBER_OF_SECTIONS];
+	Mesh* m_SectionMeshes[NUMBER_OF_SECTIONS];
 	Mesh* m_WaterMesh;
 
 	IntVector2 m_ChunkCoordinates;
 	Vector3 m_ChunkWorldMinimums;
+	size_t m_ChunkSlotIndex;
 };
 
 
 
+inline Block Chunk::GetBlock(int localIndex) const
+{
+	return Block(m_BlockTypes.GetBlockType(localIndex), m_PackedLight[localIndex]);
+}
+
+
+
+inline uint8_t Chunk::GetBlockType(int localIndex) const
+{
+	return m_BlockTypes.GetBlockType(localIndex);
+}
+
+
+
+inline void Chunk::SetBlockType(int localIndex, uint8_t blockType)
+{
+	m_BlockTypes.SetBlockType(localIndex, blockType);
+}
+
+
+
+inline uint8_t Chunk::GetPackedLight(int localIndex) const
+{
+	return m_PackedLight[localIndex];
+}
+
+
+
+inline int Chunk::GetLightValue(int localIndex, uint8_t lightChannel) const
+{
+	return static_cast<int>((m_PackedLight[localIndex] >> (lightChannel * LIGHT_CHANNEL_BITS)) & LIGHT_CHANNEL_MASK);
+}
+
+
+
+inline void Chunk::SetLightValue(int localIndex, uint8_t lightChannel, int lightValue)
+{
+	int channelShift = lightChannel * LIGHT_CHANNEL_BITS;
+
+	ClearBits(m_PackedLight[localIndex], static_cast<unsigned char>(LIGHT_CHANNEL_MASK << channelShift));
+	SetBits(m_PackedLight[localIndex], static_cast<unsigned char>(lightValue << channelShift));
+}
+
+
+
+inline bool Chunk::IsSky(int localIndex) const
+{
+	return (GetLayerIndexforLocalIndex(localIndex) >= m_ColumnHeights[GetColumnIndexForLocalIndex(localIndex)]);
+}
+
+
+
+inline bool Chunk::UsesPalettedBlockStorage() const
+{
+	return m_BlockTypes.UsesPalette();
+}
+
+
+
+inline void Chunk::SetUsesPalettedBlockStorage(bool usesPalettedBlockStorage)
+{
+	m_BlockTypes.SetUsesPalette(usesPalettedBlockStorage);
+}
+
+
+
+inline size_t Chunk::GetNumberOfBlockTypeBytes() const
+{
+	return m_BlockTypes.GetNumberOfBytes();
+}
+
+
+
 inline bool Chunk::IsModified()
 {
-	return m_IsModified;
+	return (m_ModifiedSections != 0U);
 }
 
 
 
 inline void Chunk::SetModified(bool modified)
 {
-	m_IsModified = modified;
+	m_ModifiedSections = (modified) ? ALL_SECTIONS_MASK : 0U;
+}
+
+
+
+inline uint8_t Chunk::GetModifiedSections()
+{
+	return m_ModifiedSections;
+}
+
+
+
+inline void Chunk::MarkSectionModified(int sectionIndex)
+{
+	m_ModifiedSections |= static_cast<uint8_t>(1U << sectionIndex);
+}
+
+
+
+inline void Chunk::MarkSectionsModifiedForLocalIndex(int localIndex)
+{
+	int sectionIndex = GetSectionIndexForLocalIndex(localIndex);
+	m_ModifiedSections |= static_cast<uint8_t>(1U << sectionIndex);
+
+	int sectionBlockZ = GetLayerIndexforLocalIndex(localIndex) & SECTION_Z_MASK;
+	if (sectionBlockZ == 0 && sectionIndex > 0)
+	{
+		m_ModifiedSections |= static_cast<uint8_t>(1U << (sectionIndex - 1));
+	}
+	else if (sectionBlockZ == SECTION_Z_MASK && sectionIndex < NUMBER_OF_SECTIONS - 1)
+	{
+		m_ModifiedSections |= static_cast<uint8_t>(1U << (sectionIndex + 1));
+	}
+}
+
+
+
+inline void Chunk::MarkBlockTypeAsChanged(int localIndex)
+{
+	UpdateSectionBlockType(GetSectionIndexForLocalIndex(localIndex));
+	UpdateColumnHeightForLocalIndex(localIndex);
+	MarkSectionsModifiedForLocalIndex(localIndex);
+}
+
+
+
+inline int Chunk::GetColumnHeight(int columnIndex) const
+{
+	return static_cast<int>(m_ColumnHeights[columnIndex]);
+}
+
+
+
+inline uint8_t Chunk::GetSectionBlockType(int sectionIndex) const
+{
+	return m_SectionBlockTypes[sectionIndex];
+}
+
+
+
+inline bool Chunk::IsPopulated()
+{
+	return m_IsPopulated;
+}
+
+
+
+inline bool Chunk::NeedsUrgentRebuild()
+{
+	return m_NeedsUrgentRebuild;
+}
+
+
+
+inline void Chunk::SetNeedsUrgentRebuild(bool needsUrgentRebuild)
+{
+	m_NeedsUrgentRebuild = needsUrgentRebuild;
+}
+
+
+
+inline bool Chunk::MeshIsInFlight()
+{
+	return (m_MeshRevisionInFlight != 0U);
+}
+
+
+
+inline uint32_t Chunk::GetMeshRevisionInFlight()
+{
+	return m_MeshRevisionInFlight;
+}
+
+
+
+inline void Chunk::SetMeshRevisionInFlight(uint32_t meshRevision)
+{
+	m_MeshRevisionInFlight = meshRevision;
+}
+
+
+
+inline uint8_t Chunk::GetSectionsInFlight()
+{
+	return m_SectionsInFlight;
+}
+
+
+
+inline void Chunk::SetSectionsInFlight(uint8_t sectionsInFlight)
+{
+	m_SectionsInFlight = sectionsInFlight;
+}
+
+
+
+inline size_t Chunk::GetNumberOfMeshVertices()
+{
+	return m_NumberOfMeshVertices;
+}
+
+
+
+inline size_t Chunk::GetNumberOfMeshIndices()
+{
+	return m_NumberOfMeshIndices;
 }
 
 
@@ -137,6 +430,20 @@ inline Vector3 Chunk::GetChunkWorldMinimums()
 
 
 
+inline size_t Chunk::GetChunkSlotIndex() const
+{
+	return m_ChunkSlotIndex;
+}
+
+
+
+inline void Chunk::SetChunkSlotIndex(size_t chunkSlotIndex)
+{
+	m_ChunkSlotIndex = chunkSlotIndex;
+}
+
+
+
 inline int Chunk::GetLocalIndexForBlockWorldCoordinates(const Vector3& blockWorldCoordinates) const
 {
 	Vector3 blockRelativePosition = blockWorldCoordinates - m_ChunkWorldMinimums;
@@ -182,6 +489,24 @@ inline int Chunk::GetLayerIndexforLocalCoordinates(const IntVector3& localCoordi
 
 
 
+inline int Chunk::GetSectionIndexForLocalIndex(int localIndex) const
+{
+	int sectionIndex = localIndex >> BLOCK_BITS_PER_SECTION;
+
+	return sectionIndex;
+}
+
+
+
+inline int Chunk::GetColumnIndexForLocalIndex(int localIndex) const
+{
+	int columnIndex = localIndex & COLUMN_INDEX_MASK;
+
+	return columnIndex;
+}
+
+
+
 inline IntVector3 Chunk::GetLocalCoordinatesForLocalIndex(int localIndex) const
 {
 	IntVector3 localCoordinates;
@@ -244,4 +569,14 @@ inline Vector3 Chunk::GetChunkWorldMinimumsForChunkCoordinates(const IntVector2&
 	float worldMinimumsZ = 0.0f;
 
 	return Vector3(worldMinimumsX, worldMinimumsY, worldMinimumsZ);
+}
+
+
+
+inline uint32_t Chunk::HashChunkCoordinates(const IntVector2& chunkCoordinates)
+{
+	uint32_t hashX = static_cast<uint32_t>(chunkCoordinates.X) * 73856093U;
+	uint32_t hashY = static_cast<uint32_t>(chunkCoordinates.Y) * 19349663U;
+
+	return (hashX ^ hashY) * 2654435761U;
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "Game/ChunkMeshScratchArena.hpp"
+
+
+
+std::atomic<size_t> ChunkMeshScratchArena::s_NumberOfAllocations(0U);
+
+
+
+ChunkMeshScratchArena::ChunkMeshScratchArena() :
+m_CapacityAtBegin(0U)
+{
+	m_MeshVertices.reserve(INITIAL_SCRATCH_VERTEX_CAPACITY);
+}
+
+
+
+std::vector<Vertex3D>& ChunkMeshScratchArena::BeginMeshVertices()
+{
+	m_MeshVertices.clear();
+	m_CapacityAtBegin = m_MeshVertices.capacity();
+
+	return m_MeshVertices;
+}
+
+
+
+void ChunkMeshScratchArena::EndMeshVertices(std::vector<Vertex3D>& meshVertices)
+{
+	if (m_MeshVertices.capacity() > m_CapacityAtBegin)
+	{
+		s_NumberOfAllocations.fetch_add(1U, std::memory_order_relaxed);
+	}
+
+	meshVertices.swap(m_MeshVertices);
+	m_MeshVertices.clear();
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include <atomic>
+
+
+
+enum BlockFace : uint8_t
+{
+	EAST_FACE,
+	WEST_FACE,
+	NORTH_FACE,
+	SOUTH_FACE,
+	TOP_FACE,
+	BOTTOM_FACE,
+	NUMBER_OF_BLOCK_FACES
+};
+
+
+
+const size_t INITIAL_SCRATCH_VERTEX_CAPACITY = 16384U;
+const size_t GREEDY_FACE_MASK_SIZE = NUMBER_OF_BLOCKS_X * NUMBER_OF_BLOCKS_PER_SECTION_Z;
+const int NUMBER_OF_BLOCK_ROWS = NUMBER_OF_BLOCKS_PER_CHUNK >> BLOCK_BITS_X;
+const int NUMBER_OF_BLOCK_ROWS_PER_SECTION = NUMBER_OF_BLOCKS_PER_SECTION >> BLOCK_BITS_X;
+
+
+
+class ChunkMeshScratchArena
+{
+public:
+	ChunkMeshScratchArena();
+
+	std::vector<Vertex3D>& BeginMeshVertices();
+	void EndMeshVertices(std::vector<Vertex3D>& meshVertices);
+
+	uint16_t* GetGreedyFaceMask();
+	uint16_t* GetSolidRows();
+	uint16_t* GetTransparentRows();
+	uint16_t* GetExposedFaceRows(uint8_t blockFace);
+
+	static size_t GetNumberOfAllocations();
+
+private:
+	static std::atomic<size_t> s_NumberOfAllocations;
+
+	std::vector<Vertex3D> m_MeshVertices;
+	size_t m_CapacityAtBegin;
+	uint16_t m_GreedyFaceMask[GREEDY_FACE_MASK_SIZE];
+	uint16_t m_SolidRows[NUMBER_OF_BLOCK_ROWS];
+	uint16_t m_TransparentRows[NUMBER_OF_BLOCK_ROWS];
+	uint16_t m_ExposedFaceRows[NUMBER_OF_BLOCK_FACES][NUMBER_OF_BLOCK_ROWS];
+};
+
+
+
+inline uint16_t* ChunkMeshScratchArena::GetGreedyFaceMask()
+{
+	return m_GreedyFaceMask;
+}
+
+
+
+inline uint16_t* ChunkMeshScratchArena::GetSolidRows()
+{
+	return m_SolidRows;
+}
+
+
+
+inline uint16_t* ChunkMeshScratchArena::GetTransparentRows()
+{
+	return m_TransparentRows;
+}
+
+
+
+inline uint16_t* ChunkMeshScratchArena::GetExposedFaceRows(uint8_t blockFace)
+{
+	return m_ExposedFaceRows[blockFace];
+}
+
+
+
+inline size_t ChunkMeshScratchArena::GetNumberOfAllocations()
+{
+	return s_NumberOfAllocations.load(std::memory_order_relaxed);
+}
\ No newline at end of file
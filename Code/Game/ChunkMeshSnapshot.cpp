@@ -0,0 +1,518 @@
+#include "Game/ChunkMeshSnapshot.hpp"
+
+
+
+struct FaceCorner
+{
+	uint8_t m_X;
+	uint8_t m_Y;
+	uint8_t m_Z;
+	uint8_t m_U;
+	uint8_t m_V;
+};
+
+
+
+const FaceCorner FACE_CORNERS[NUMBER_OF_BLOCK_FACES][4] =
+{
+	{ { 1, 1, 0, 1, 1 }, { 1, 1, 1, 1, 0 }, { 1, 0, 1, 0, 0 }, { 1, 0, 0, 0, 1 } },
+	{ { 0, 1, 0, 0, 1 }, { 0, 0, 0, 1, 1 }, { 0, 0, 1, 1, 0 }, { 0, 1, 1, 0, 0 } },
+	{ { 1, 1, 0, 0, 1 }, { 0, 1, 0, 1, 1 }, { 0, 1, 1, 1, 0 }, { 1, 1, 1, 0, 0 } },
+	{ { 1, 0, 0, 1, 1 }, { 1, 0, 1, 1, 0 }, { 0, 0, 1, 0, 0 }, { 0, 0, 0, 0, 1 } },
+	{ { 1, 0, 1, 1, 1 }, { 1, 1, 1, 1, 0 }, { 0, 1, 1, 0, 0 }, { 0, 0, 1, 0, 1 } },
+	{ { 1, 0, 0, 0, 1 }, { 0, 0, 0, 1, 1 }, { 0, 1, 0, 1, 0 }, { 1, 1, 0, 0, 0 } }
+};
+
+
+
+ChunkMeshSnapshot::ChunkMeshSnapshot() :
+m_ChunkCoordinates(IntVector2::ZERO),
+m_ChunkWorldMinimums(Vector3::ZERO),
+m_UseGreedyMeshing(false),
+m_SectionsToBuild(ALL_SECTIONS_MASK)
+{
+	for (int borderIndex = 0; borderIndex < NUMBER_OF_CHUNK_BORDERS; ++borderIndex)
+	{
+		m_BorderIsConnected[borderIndex] = false;
+	}
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		m_SectionBlockTypes[sectionIndex] = INVALID_BLOCK;
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildChunkMesh(ChunkMeshScratchArena& scratchArena)
+{
+	uint8_t sectionsToMask = static_cast<uint8_t>(m_SectionsToBuild | (m_SectionsToBuild << 1) | (m_SectionsToBuild >> 1));
+	BuildBlockRowMasks(sectionsToMask, scratchArena);
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		if ((m_SectionsToBuild & (1U << sectionIndex)) == 0U)
+		{
+			continue;
+		}
+
+		std::vector<Vertex3D>& sectionVertices = scratchArena.BeginMeshVertices();
+
+		if (!SectionHasNoSolidFaces(sectionIndex))
+		{
+			BuildExposedFaceMasks(sectionIndex, scratchArena);
+
+			if (m_UseGreedyMeshing)
+			{
+				for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+				{
+					BuildGreedyFaces(sectionIndex, blockFace, sectionVertices, scratchArena);
+				}
+			}
+			else
+			{
+				BuildPerFaceQuads(sectionIndex, sectionVertices, scratchArena);
+			}
+		}
+
+		scratchArena.EndMeshVertices(m_SectionVertices[sectionIndex]);
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildWaterMesh(ChunkMeshScratchArena& scratchArena)
+{
+	std::vector<Vertex3D>& waterVertices = scratchArena.BeginMeshVertices();
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		uint8_t sectionBlockType = m_SectionBlockTypes[sectionIndex];
+		if (sectionBlockType != INVALID_BLOCK && sectionBlockType != WATER_BLOCK)
+		{
+			continue;
+		}
+
+		int firstBlockIndex = sectionIndex << BLOCK_BITS_PER_SECTION;
+		for (int blockIndex = firstBlockIndex; blockIndex < firstBlockIndex + NUMBER_OF_BLOCKS_PER_SECTION; ++blockIndex)
+		{
+			uint8_t currentBlockType = m_BlockTypes[blockIndex];
+			if (BlockDefinition::IsVisible(currentBlockType) && !BlockDefinition::IsOpaque(currentBlockType))
+			{
+				bool isTopMostBlock = ((blockIndex >> BLOCK_BITS_PER_LAYER) == BLOCKS_Z_MASK);
+				if (isTopMostBlock || m_BlockTypes[blockIndex + NUMBER_OF_BLOCKS_PER_LAYER] == AIR_BLOCK)
+				{
+					IntVector3 blockMinimums = GetLocalCoordinatesForLocalIndex(blockIndex);
+					IntVector3 blockMaximums = IntVector3(blockMinimums.X + 1, blockMinimums.Y + 1, blockMinimums.Z + 1);
+
+					Block currentBlock = Block(currentBlockType);
+					AppendFaceQuad(waterVertices, TOP_FACE, blockMinimums, blockMaximums, GetFaceTextureAABB(currentBlock, TOP_FACE), 0U);
+				}
+			}
+		}
+	}
+
+	scratchArena.EndMeshVertices(m_WaterVertices);
+}
+
+
+
+void ChunkMeshSnapshot::BuildExposedFacesFromRowMasks(ChunkMeshScratchArena& scratchArena) const
+{
+	BuildBlockRowMasks(ALL_SECTIONS_MASK, scratchArena);
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		BuildExposedFaceMasks(sectionIndex, scratchArena);
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildBlockRowMasks(uint8_t sectionsToMask, ChunkMeshScratchArena& scratchArena) const
+{
+	uint16_t* solidRows = scratchArena.GetSolidRows();
+	uint16_t* transparentRows = scratchArena.GetTransparentRows();
+
+	for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+	{
+		if ((sectionsToMask & (1U << sectionIndex)) == 0U)
+		{
+			continue;
+		}
+
+		int firstRowIndex = sectionIndex * NUMBER_OF_BLOCK_ROWS_PER_SECTION;
+		uint8_t sectionBlockType = m_SectionBlockTypes[sectionIndex];
+
+		if (sectionBlockType != INVALID_BLOCK)
+		{
+			uint16_t solidRow = (BlockDefinition::IsOpaque(sectionBlockType) && BlockDefinition::IsVisible(sectionBlockType)) ? 0xFFFFU : 0U;
+			uint16_t transparentRow = (!BlockDefinition::IsOpaque(sectionBlockType)) ? 0xFFFFU : 0U;
+
+			for (int rowIndex = firstRowIndex; rowIndex < firstRowIndex + NUMBER_OF_BLOCK_ROWS_PER_SECTION; ++rowIndex)
+			{
+				solidRows[rowIndex] = solidRow;
+				transparentRows[rowIndex] = transparentRow;
+			}
+
+			continue;
+		}
+
+		for (int rowIndex = firstRowIndex; rowIndex < firstRowIndex + NUMBER_OF_BLOCK_ROWS_PER_SECTION; ++rowIndex)
+		{
+			const uint8_t* rowBlockTypes = &m_BlockTypes[rowIndex << BLOCK_BITS_X];
+
+			uint16_t solidRow = 0U;
+			uint16_t transparentRow = 0U;
+			for (int blockX = 0; blockX < NUMBER_OF_BLOCKS_X; ++blockX)
+			{
+				uint16_t blockBit = static_cast<uint16_t>(1U << blockX);
+				if (!BlockDefinition::IsOpaque(rowBlockTypes[blockX]))
+				{
+					transparentRow |= blockBit;
+				}
+				else if (BlockDefinition::IsVisible(rowBlockTypes[blockX]))
+				{
+					solidRow |= blockBit;
+				}
+			}
+
+			solidRows[rowIndex] = solidRow;
+			transparentRows[rowIndex] = transparentRow;
+		}
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildExposedFaceMasks(int sectionIndex, ChunkMeshScratchArena& scratchArena) const
+{
+	const uint16_t* solidRows = scratchArena.GetSolidRows();
+	const uint16_t* transparentRows = scratchArena.GetTransparentRows();
+
+	uint16_t* easternRows = scratchArena.GetExposedFaceRows(EAST_FACE);
+	uint16_t* westernRows = scratchArena.GetExposedFaceRows(WEST_FACE);
+	uint16_t* northernRows = scratchArena.GetExposedFaceRows(NORTH_FACE);
+	uint16_t* southernRows = scratchArena.GetExposedFaceRows(SOUTH_FACE);
+	uint16_t* topRows = scratchArena.GetExposedFaceRows(TOP_FACE);
+	uint16_t* bottomRows = scratchArena.GetExposedFaceRows(BOTTOM_FACE);
+
+	int firstBlockZ = sectionIndex << SECTION_BITS_Z;
+	for (int blockZ = firstBlockZ; blockZ < firstBlockZ + NUMBER_OF_BLOCKS_PER_SECTION_Z; ++blockZ)
+	{
+		int layerRowIndex = blockZ << BLOCK_BITS_Y;
+
+		uint16_t easternBorderRow = GetTransparentBorderRow(EASTERN_BORDER, blockZ);
+		uint16_t westernBorderRow = GetTransparentBorderRow(WESTERN_BORDER, blockZ);
+
+		for (int blockY = 0; blockY < NUMBER_OF_BLOCKS_Y; ++blockY)
+		{
+			int rowIndex = layerRowIndex + blockY;
+
+			uint16_t easternNeighbours = static_cast<uint16_t>((transparentRows[rowIndex] >> 1) | (((easternBorderRow >> blockY) & 1U) << BLOCKS_X_MASK));
+			uint16_t westernNeighbours = static_cast<uint16_t>((transparentRows[rowIndex] << 1) | ((westernBorderRow >> blockY) & 1U));
+
+			easternRows[rowIndex] = solidRows[rowIndex] & easternNeighbours;
+			westernRows[rowIndex] = solidRows[rowIndex] & westernNeighbours;
+		}
+
+		for (int blockY = 0; blockY < BLOCKS_Y_MASK; ++blockY)
+		{
+			northernRows[layerRowIndex + blockY] = solidRows[layerRowIndex + blockY] & transparentRows[layerRowIndex + blockY + 1];
+			southernRows[layerRowIndex + blockY + 1] = solidRows[layerRowIndex + blockY + 1] & transparentRows[layerRowIndex + blockY];
+		}
+
+		northernRows[layerRowIndex + BLOCKS_Y_MASK] = solidRows[layerRowIndex + BLOCKS_Y_MASK] & GetTransparentBorderRow(NORTHERN_BORDER, blockZ);
+		southernRows[layerRowIndex] = solidRows[layerRowIndex] & GetTransparentBorderRow(SOUTHERN_BORDER, blockZ);
+
+		for (int blockY = 0; blockY < NUMBER_OF_BLOCKS_Y; ++blockY)
+		{
+			int rowIndex = layerRowIndex + blockY;
+
+			topRows[rowIndex] = (blockZ < BLOCKS_Z_MASK) ? (solidRows[rowIndex] & transparentRows[rowIndex + NUMBER_OF_BLOCKS_Y]) : 0U;
+			bottomRows[rowIndex] = (blockZ > 0) ? (solidRows[rowIndex] & transparentRows[rowIndex - NUMBER_OF_BLOCKS_Y]) : 0U;
+		}
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildPerFaceQuads(int sectionIndex, std::vector<Vertex3D>& meshVertices, ChunkMeshScratchArena& scratchArena)
+{
+	const uint16_t* exposedFaceRows[NUMBER_OF_BLOCK_FACES];
+	for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+	{
+		exposedFaceRows[blockFace] = scratchArena.GetExposedFaceRows(blockFace);
+	}
+
+	int firstRowIndex = sectionIndex * NUMBER_OF_BLOCK_ROWS_PER_SECTION;
+	for (int rowIndex = firstRowIndex; rowIndex < firstRowIndex + NUMBER_OF_BLOCK_ROWS_PER_SECTION; ++rowIndex)
+	{
+		uint16_t exposedRow = 0U;
+		for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+		{
+			exposedRow |= exposedFaceRows[blockFace][rowIndex];
+		}
+
+		if (exposedRow == 0U)
+		{
+			continue;
+		}
+
+		for (int blockX = 0; blockX < NUMBER_OF_BLOCKS_X; ++blockX)
+		{
+			uint16_t blockBit = static_cast<uint16_t>(1U << blockX);
+			if ((exposedRow & blockBit) == 0U)
+			{
+				continue;
+			}
+
+			int blockIndex = (rowIndex << BLOCK_BITS_X) + blockX;
+			Block currentBlock = Block(m_BlockTypes[blockIndex]);
+
+			IntVector3 blockMinimums = GetLocalCoordinatesForLocalIndex(blockIndex);
+			IntVector3 blockMaximums = IntVector3(blockMinimums.X + 1, blockMinimums.Y + 1, blockMinimums.Z + 1);
+
+			for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+			{
+				if ((exposedFaceRows[blockFace][rowIndex] & blockBit) != 0U)
+				{
+					uint8_t packedLight = GetNeighbourPackedLightForFace(blockIndex, blockFace);
+					AppendFaceQuad(meshVertices, blockFace, blockMinimums, blockMaximums, GetFaceTextureAABB(currentBlock, blockFace), packedLight);
+				}
+			}
+		}
+	}
+}
+
+
+
+void ChunkMeshSnapshot::BuildGreedyFaces(int sectionIndex, uint8_t blockFace, std::vector<Vertex3D>& meshVertices, ChunkMeshScratchArena& scratchArena)
+{
+	uint16_t* greedyFaceMask = scratchArena.GetGreedyFaceMask();
+	const uint16_t* exposedFaceRows = scratchArena.GetExposedFaceRows(blockFace);
+
+	int sectionMinimumZ = sectionIndex << SECTION_BITS_Z;
+
+	int firstSliceIndex = 0;
+	int firstRowIndex = sectionMinimumZ;
+	int numberOfSlices = NUMBER_OF_BLOCKS_X;
+	int numberOfColumns = NUMBER_OF_BLOCKS_Y;
+	int numberOfRows = NUMBER_OF_BLOCKS_PER_SECTION_Z;
+
+	if (blockFace == NORTH_FACE || blockFace == SOUTH_FACE)
+	{
+		numberOfSlices = NUMBER_OF_BLOCKS_Y;
+		numberOfColumns = NUMBER_OF_BLOCKS_X;
+	}
+	else if (blockFace == TOP_FACE || blockFace == BOTTOM_FACE)
+	{
+		firstSliceIndex = sectionMinimumZ;
+		firstRowIndex = 0;
+		numberOfSlices = NUMBER_OF_BLOCKS_PER_SECTION_Z;
+		numberOfColumns = NUMBER_OF_BLOCKS_X;
+		numberOfRows = NUMBER_OF_BLOCKS_Y;
+	}
+
+	for (int sliceIndex = firstSliceIndex; sliceIndex < firstSliceIndex + numberOfSlices; ++sliceIndex)
+	{
+		for (int rowIndex = 0; rowIndex < numberOfRows; ++rowIndex)
+		{
+			for (int columnIndex = 0; columnIndex < numberOfColumns; ++columnIndex)
+			{
+				int blockIndex = GetLocalIndexForFaceSliceCoordinates(blockFace, sliceIndex, columnIndex, firstRowIndex + rowIndex);
+				greedyFaceMask[(rowIndex * numberOfColumns) + columnIndex] = GetGreedyFaceKey(blockIndex, blockFace, exposedFaceRows);
+			}
+		}
+
+		for (int rowIndex = 0; rowIndex < numberOfRows; ++rowIndex)
+		{
+			for (int columnIndex = 0; columnIndex < numberOfColumns;)
+			{
+				uint16_t faceKey = greedyFaceMask[(rowIndex * numberOfColumns) + columnIndex];
+				if (faceKey == 0U)
+				{
+					++columnIndex;
+					continue;
+				}
+
+				int quadWidth = 1;
+				while (columnIndex + quadWidth < numberOfColumns && greedyFaceMask[(rowIndex * numberOfColumns) + columnIndex + quadWidth] == faceKey)
+				{
+					++quadWidth;
+				}
+
+				int quadHeight = 1;
+				bool quadCanGrow = true;
+				while (rowIndex + quadHeight < numberOfRows && quadCanGrow)
+				{
+					const uint16_t* nextRow = &greedyFaceMask[((rowIndex + quadHeight) * numberOfColumns) + columnIndex];
+					for (int widthIndex = 0; widthIndex < quadWidth; ++widthIndex)
+					{
+						if (nextRow[widthIndex] != faceKey)
+						{
+							quadCanGrow = false;
+							break;
+						}
+					}
+
+					if (quadCanGrow)
+					{
+						++quadHeight;
+					}
+				}
+
+				for (int heightIndex = 0; heightIndex < quadHeight; ++heightIndex)
+				{
+					uint16_t* mergedRow = &greedyFaceMask[((rowIndex + heightIndex) * numberOfColumns) + columnIndex];
+					for (int widthIndex = 0; widthIndex < quadWidth; ++widthIndex)
+					{
+						mergedRow[widthIndex] = 0U;
+					}
+				}
+
+				int firstBlockIndex = GetLocalIndexForFaceSliceCoordinates(blockFace, sliceIndex, columnIndex, firstRowIndex + rowIndex);
+				int lastBlockIndex = GetLocalIndexForFaceSliceCoordinates(blockFace, sliceIndex, columnIndex + quadWidth - 1, firstRowIndex + rowIndex + quadHeight - 1);
+
+				IntVector3 quadMinimums = GetLocalCoordinatesForLocalIndex(firstBlockIndex);
+				IntVector3 quadMaximums = GetLocalCoordinatesForLocalIndex(lastBlockIndex);
+				quadMaximums = IntVector3(quadMaximums.X + 1, quadMaximums.Y + 1, quadMaximums.Z + 1);
+
+				uint16_t blockAndLight = faceKey - 1U;
+				Block mergedBlock = Block(static_cast<uint8_t>(blockAndLight >> PACKED_LIGHT_BITS));
+				uint8_t packedLight = static_cast<uint8_t>(blockAndLight);
+
+				AppendFaceQuad(meshVertices, blockFace, quadMinimums, quadMaximums, GetFaceTextureAABB(mergedBlock, blockFace), packedLight);
+
+				columnIndex += quadWidth;
+			}
+		}
+	}
+}
+
+
+
+uint16_t ChunkMeshSnapshot::GetGreedyFaceKey(int blockIndex, uint8_t blockFace, const uint16_t* exposedFaceRows) const
+{
+	uint16_t exposedRow = exposedFaceRows[blockIndex >> BLOCK_BITS_X];
+	if ((exposedRow & (1U << (blockIndex & BLOCKS_X_MASK))) == 0U)
+	{
+		return 0U;
+	}
+
+	uint8_t packedLight = GetNeighbourPackedLightForFace(blockIndex, blockFace);
+	uint16_t blockAndLight = static_cast<uint16_t>((m_BlockTypes[blockIndex] << PACKED_LIGHT_BITS) | packedLight);
+
+	return blockAndLight + 1U;
+}
+
+
+
+void ChunkMeshSnapshot::AppendFaceQuad(std::vector<Vertex3D>& meshVertices, uint8_t blockFace, const IntVector3& quadMinimums, const IntVector3& quadMaximums, const AABB2& faceTexture, uint8_t packedLight)
+{
+	Vertex3D chunkVertex;
+	chunkVertex.m_Color = GetFaceColorForPackedLight(packedLight);
+
+	int textureWidth = quadMaximums.X - quadMinimums.X;
+	int textureHeight = quadMaximums.Y - quadMinimums.Y;
+
+	switch (blockFace)
+	{
+	case EAST_FACE:
+		chunkVertex.m_Tangent = Vector3(0.0f, 1.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 0.0f, 1.0f);
+		chunkVertex.m_Normal = Vector3(1.0f, 0.0f, 0.0f);
+		textureWidth = quadMaximums.Y - quadMinimums.Y;
+		textureHeight = quadMaximums.Z - quadMinimums.Z;
+		break;
+
+	case WEST_FACE:
+		chunkVertex.m_Tangent = Vector3(0.0f, -1.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 0.0f, 1.0f);
+		chunkVertex.m_Normal = Vector3(-1.0f, 0.0f, 0.0f);
+		textureWidth = quadMaximums.Y - quadMinimums.Y;
+		textureHeight = quadMaximums.Z - quadMinimums.Z;
+		break;
+
+	case NORTH_FACE:
+		chunkVertex.m_Tangent = Vector3(-1.0f, 0.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 0.0f, 1.0f);
+		chunkVertex.m_Normal = Vector3(0.0f, 1.0f, 0.0f);
+		textureHeight = quadMaximums.Z - quadMinimums.Z;
+		break;
+
+	case SOUTH_FACE:
+		chunkVertex.m_Tangent = Vector3(1.0f, 0.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 0.0f, 1.0f);
+		chunkVertex.m_Normal = Vector3(0.0f, -1.0f, 0.0f);
+		textureHeight = quadMaximums.Z - quadMinimums.Z;
+		break;
+
+	case TOP_FACE:
+		chunkVertex.m_Tangent = Vector3(1.0f, 0.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 1.0f, 0.0f);
+		chunkVertex.m_Normal = Vector3(0.0f, 0.0f, 1.0f);
+		break;
+
+	default:
+		chunkVertex.m_Tangent = Vector3(-1.0f, 0.0f, 0.0f);
+		chunkVertex.m_Bitangent = Vector3(0.0f, 1.0f, 0.0f);
+		chunkVertex.m_Normal = Vector3(0.0f, 0.0f, -1.0f);
+		break;
+	}
+
+	for (int cornerIndex = 0; cornerIndex < 4; ++cornerIndex)
+	{
+		const FaceCorner& faceCorner = FACE_CORNERS[blockFace][cornerIndex];
+
+		chunkVertex.m_Position.X = static_cast<float>((faceCorner.m_X != 0U) ? quadMaximums.X : quadMinimums.X);
+		chunkVertex.m_Position.Y = static_cast<float>((faceCorner.m_Y != 0U) ? quadMaximums.Y : quadMinimums.Y);
+		chunkVertex.m_Position.Z = static_cast<float>((faceCorner.m_Z != 0U) ? quadMaximums.Z : quadMinimums.Z);
+
+		float tileU = static_cast<float>((faceCorner.m_U != 0U) ? textureWidth : 0);
+		float tileV = static_cast<float>((faceCorner.m_V != 0U) ? textureHeight : 0);
+		chunkVertex.m_TextureCoordinates = GetTiledTextureCoordinates(faceTexture, tileU, tileV);
+
+		meshVertices.push_back(chunkVertex);
+	}
+}
+
+
+
+AABB2 ChunkMeshSnapshot::GetFaceTextureAABB(const Block& currentBlock, uint8_t blockFace) const
+{
+	switch (blockFace)
+	{
+	case TOP_FACE:
+		return currentBlock.GetTopFaceTextureAABB();
+
+	case BOTTOM_FACE:
+		return currentBlock.GetBottomFaceTextureAABB();
+
+	default:
+		return currentBlock.GetSideFaceTextureAABB();
+	}
+}
+
+
+
+Vector2 ChunkMeshSnapshot::GetTiledTextureCoordinates(const AABB2& faceTexture, float tileU, float tileV) const
+{
+	float tileWidth = faceTexture.maximums.X - faceTexture.minimums.X;
+	float tileHeight = faceTexture.maximums.Y - faceTexture.minimums.Y;
+
+	float tileColumn = RoundDownToFloorValue((faceTexture.minimums.X / tileWidth) + 0.5f);
+	float tileRow = RoundDownToFloorValue((faceTexture.minimums.Y / tileHeight) + 0.5f);
+
+	return Vector2((tileColumn * TEXTURE_TILE_STRIDE) + tileU, (tileRow * TEXTURE_TILE_STRIDE) + tileV);
+}
+
+
+
+RGBA ChunkMeshSnapshot::GetFaceColorForPackedLight(uint8_t packedLight) const
+{
+	unsigned char blockLight = static_cast<unsigned char>((packedLight & LIGHT_CHANNEL_MASK) * 17);
+	unsigned char skyLight = static_cast<unsigned char>((packedLight >> (SKY_LIGHT_CHANNEL * LIGHT_CHANNEL_BITS)) * 17);
+
+	return RGBA(blockLight, skyLight, 0, 255);
+}
\ No newline at end of file
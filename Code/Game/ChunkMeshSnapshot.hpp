@@ -0,0 +1,276 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/Block.hpp"
+#include "Game/ChunkMeshScratchArena.hpp"
+
+
+
+enum ChunkBorder : uint8_t
+{
+	EASTERN_BORDER,
+	WESTERN_BORDER,
+	NORTHERN_BORDER,
+	SOUTHERN_BORDER,
+	NUMBER_OF_CHUNK_BORDERS
+};
+
+
+
+const int NUMBER_OF_BLOCKS_PER_BORDER = NUMBER_OF_BLOCKS_X * NUMBER_OF_BLOCKS_Z;
+const int PACKED_LIGHT_BITS = 8;
+const float TEXTURE_TILE_STRIDE = 256.0f;
+
+
+
+class ChunkMeshSnapshot
+{
+public:
+	ChunkMeshSnapshot();
+
+	void BuildChunkMesh(ChunkMeshScratchArena& scratchArena);
+	void BuildWaterMesh(ChunkMeshScratchArena& scratchArena);
+
+	void BuildExposedFacesFromRowMasks(ChunkMeshScratchArena& scratchArena) const;
+
+	static int GetBorderIndexForLocalCoordinates(int horizontalCoordinate, int verticalCoordinate);
+
+private:
+	void BuildBlockRowMasks(uint8_t sectionsToMask, ChunkMeshScratchArena& scratchArena) const;
+	void BuildExposedFaceMasks(int sectionIndex, ChunkMeshScratchArena& scratchArena) const;
+	void BuildPerFaceQuads(int sectionIndex, std::vector<Vertex3D>& meshVertices, ChunkMeshScratchArena& scratchArena);
+	void BuildGreedyFaces(int sectionIndex, uint8_t blockFace, std::vector<Vertex3D>& meshVertices, ChunkMeshScratchArena& scratchArena);
+	bool SectionHasNoSolidFaces(int sectionIndex) const;
+	uint16_t GetGreedyFaceKey(int blockIndex, uint8_t blockFace, const uint16_t* exposedFaceRows) const;
+	void AppendFaceQuad(std::vector<Vertex3D>& meshVertices, uint8_t blockFace, const IntVector3& quadMinimums, const IntVector3& quadMaximums, const AABB2& faceTexture, uint8_t packedLight);
+
+	AABB2 GetFaceTextureAABB(const Block& currentBlock, uint8_t blockFace) const;
+	Vector2 GetTiledTextureCoordinates(const AABB2& faceTexture, float tileU, float tileV) const;
+	RGBA GetFaceColorForPackedLight(uint8_t packedLight) const;
+
+	IntVector3 GetLocalCoordinatesForLocalIndex(int blockIndex) const;
+	int GetLocalIndexForFaceSliceCoordinates(uint8_t blockFace, int sliceIndex, int columnIndex, int rowIndex) const;
+	uint8_t GetNeighbourPackedLightForFace(int blockIndex, uint8_t blockFace) const;
+
+	uint8_t GetEasternNeighbourPackedLight(int blockIndex) const;
+	uint8_t GetWesternNeighbourPackedLight(int blockIndex) const;
+
+	uint8_t GetNorthernNeighbourPackedLight(int blockIndex) const;
+	uint8_t GetSouthernNeighbourPackedLight(int blockIndex) const;
+
+	uint8_t GetAboveNeighbourPackedLight(int blockIndex) const;
+	uint8_t GetBelowNeighbourPackedLight(int blockIndex) const;
+
+	uint16_t GetTransparentBorderRow(uint8_t chunkBorder, int blockZ) const;
+
+public:
+	IntVector2 m_ChunkCoordinates;
+	Vector3 m_ChunkWorldMinimums;
+	bool m_UseGreedyMeshing;
+	uint8_t m_SectionsToBuild;
+	uint8_t m_SectionBlockTypes[NUMBER_OF_SECTIONS];
+
+	uint8_t m_BlockTypes[NUMBER_OF_BLOCKS_PER_CHUNK];
+	uint8_t m_PackedLight[NUMBER_OF_BLOCKS_PER_CHUNK];
+	uint8_t m_BorderBlockTypes[NUMBER_OF_CHUNK_BORDERS][NUMBER_OF_BLOCKS_PER_BORDER];
+	uint8_t m_BorderPackedLight[NUMBER_OF_CHUNK_BORDERS][NUMBER_OF_BLOCKS_PER_BORDER];
+	bool m_BorderIsConnected[NUMBER_OF_CHUNK_BORDERS];
+
+	std::vector<Vertex3D> m_SectionVertices[NUMBER_OF_SECTIONS];
+	std::vector<Vertex3D> m_WaterVertices;
+};
+
+
+
+inline int ChunkMeshSnapshot::GetBorderIndexForLocalCoordinates(int horizontalCoordinate, int verticalCoordinate)
+{
+	return (verticalCoordinate << BLOCK_BITS_X) + horizontalCoordinate;
+}
+
+
+
+inline bool ChunkMeshSnapshot::SectionHasNoSolidFaces(int sectionIndex) const
+{
+	uint8_t sectionBlockType = m_SectionBlockTypes[sectionIndex];
+	if (sectionBlockType == INVALID_BLOCK)
+	{
+		return false;
+	}
+
+	return (!BlockDefinition::IsVisible(sectionBlockType) || !BlockDefinition::IsOpaque(sectionBlockType));
+}
+
+
+
+inline IntVector3 ChunkMeshSnapshot::GetLocalCoordinatesForLocalIndex(int blockIndex) const
+{
+	int localX = blockIndex & BLOCKS_X_MASK;
+	int localY = (blockIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK;
+	int localZ = blockIndex >> BLOCK_BITS_PER_LAYER;
+
+	return IntVector3(localX, localY, localZ);
+}
+
+
+
+inline int ChunkMeshSnapshot::GetLocalIndexForFaceSliceCoordinates(uint8_t blockFace, int sliceIndex, int columnIndex, int rowIndex) const
+{
+	switch (blockFace)
+	{
+	case EAST_FACE:
+	case WEST_FACE:
+		return (rowIndex << BLOCK_BITS_PER_LAYER) + (columnIndex << BLOCK_BITS_X) + sliceIndex;
+
+	case NORTH_FACE:
+	case SOUTH_FACE:
+		return (rowIndex << BLOCK_BITS_PER_LAYER) + (sliceIndex << BLOCK_BITS_X) + columnIndex;
+
+	default:
+		return (sliceIndex << BLOCK_BITS_PER_LAYER) + (rowIndex << BLOCK_BITS_X) + columnIndex;
+	}
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetNeighbourPackedLightForFace(int blockIndex, uint8_t blockFace) const
+{
+	switch (blockFace)
+	{
+	case EAST_FACE:
+		return GetEasternNeighbourPackedLight(blockIndex);
+
+	case WEST_FACE:
+		return GetWesternNeighbourPackedLight(blockIndex);
+
+	case NORTH_FACE:
+		return GetNorthernNeighbourPackedLight(blockIndex);
+
+	case SOUTH_FACE:
+		return GetSouthernNeighbourPackedLight(blockIndex);
+
+	case TOP_FACE:
+		return GetAboveNeighbourPackedLight(blockIndex);
+
+	default:
+		return GetBelowNeighbourPackedLight(blockIndex);
+	}
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetEasternNeighbourPackedLight(int blockIndex) const
+{
+	if ((blockIndex & BLOCKS_X_MASK) == BLOCKS_X_MASK)
+	{
+		if (!m_BorderIsConnected[EASTERN_BORDER])
+		{
+			return 0U;
+		}
+
+		int borderIndex = GetBorderIndexForLocalCoordinates((blockIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK, blockIndex >> BLOCK_BITS_PER_LAYER);
+		return m_BorderPackedLight[EASTERN_BORDER][borderIndex];
+	}
+
+	return m_PackedLight[blockIndex + 1];
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetWesternNeighbourPackedLight(int blockIndex) const
+{
+	if ((blockIndex & BLOCKS_X_MASK) == 0)
+	{
+		if (!m_BorderIsConnected[WESTERN_BORDER])
+		{
+			return 0U;
+		}
+
+		int borderIndex = GetBorderIndexForLocalCoordinates((blockIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK, blockIndex >> BLOCK_BITS_PER_LAYER);
+		return m_BorderPackedLight[WESTERN_BORDER][borderIndex];
+	}
+
+	return m_PackedLight[blockIndex - 1];
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetNorthernNeighbourPackedLight(int blockIndex) const
+{
+	if (((blockIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK) == BLOCKS_Y_MASK)
+	{
+		if (!m_BorderIsConnected[NORTHERN_BORDER])
+		{
+			return 0U;
+		}
+
+		int borderIndex = GetBorderIndexForLocalCoordinates(blockIndex & BLOCKS_X_MASK, blockIndex >> BLOCK_BITS_PER_LAYER);
+		return m_BorderPackedLight[NORTHERN_BORDER][borderIndex];
+	}
+
+	return m_PackedLight[blockIndex + NUMBER_OF_BLOCKS_X];
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetSouthernNeighbourPackedLight(int blockIndex) const
+{
+	if (((blockIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK) == 0)
+	{
+		if (!m_BorderIsConnected[SOUTHERN_BORDER])
+		{
+			return 0U;
+		}
+
+		int borderIndex = GetBorderIndexForLocalCoordinates(blockIndex & BLOCKS_X_MASK, blockIndex >> BLOCK_BITS_PER_LAYER);
+		return m_BorderPackedLight[SOUTHERN_BORDER][borderIndex];
+	}
+
+	return m_PackedLight[blockIndex - NUMBER_OF_BLOCKS_X];
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetAboveNeighbourPackedLight(int blockIndex) const
+{
+	if ((blockIndex >> BLOCK_BITS_PER_LAYER) == BLOCKS_Z_MASK)
+	{
+		return 0U;
+	}
+
+	return m_PackedLight[blockIndex + NUMBER_OF_BLOCKS_PER_LAYER];
+}
+
+
+
+inline uint8_t ChunkMeshSnapshot::GetBelowNeighbourPackedLight(int blockIndex) const
+{
+	if ((blockIndex >> BLOCK_BITS_PER_LAYER) == 0)
+	{
+		return 0U;
+	}
+
+	return m_PackedLight[blockIndex - NUMBER_OF_BLOCKS_PER_LAYER];
+}
+
+
+
+inline uint16_t ChunkMeshSnapshot::GetTransparentBorderRow(uint8_t chunkBorder, int blockZ) const
+{
+	if (!m_BorderIsConnected[chunkBorder])
+	{
+		return 0U;
+	}
+
+	const uint8_t* borderRowTypes = &m_BorderBlockTypes[chunkBorder][GetBorderIndexForLocalCoordinates(0, blockZ)];
+
+	uint16_t transparentRow = 0U;
+	for (int borderOffset = 0; borderOffset < NUMBER_OF_BLOCKS_X; ++borderOffset)
+	{
+		if (!BlockDefinition::IsOpaque(borderRowTypes[borderOffset]))
+		{
+			transparentRow |= static_cast<uint16_t>(1U << borderOffset);
+		}
+	}
+
+	return transparentRow;
+}
\ No newline at end of file
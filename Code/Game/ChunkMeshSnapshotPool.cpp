@@ -0,0 +1,74 @@
+#include "Game/ChunkMeshSnapshotPool.hpp"
+
+
+
+ChunkMeshSnapshotPool::ChunkMeshSnapshotPool() :
+m_MeshSnapshots(nullptr)
+{
+
+}
+
+
+
+ChunkMeshSnapshotPool::~ChunkMeshSnapshotPool()
+{
+	UninitializeChunkMeshSnapshotPool();
+}
+
+
+
+void ChunkMeshSnapshotPool::InitializeChunkMeshSnapshotPool()
+{
+	if (m_MeshSnapshots != nullptr)
+	{
+		return;
+	}
+
+	m_MeshSnapshots = new ChunkMeshSnapshot[CHUNK_MESH_SNAPSHOT_POOL_SIZE];
+
+	for (size_t snapshotIndex = 0; snapshotIndex < CHUNK_MESH_SNAPSHOT_POOL_SIZE; ++snapshotIndex)
+	{
+		m_FreeMeshSnapshots.Push(&m_MeshSnapshots[snapshotIndex]);
+	}
+}
+
+
+
+void ChunkMeshSnapshotPool::UninitializeChunkMeshSnapshotPool()
+{
+	if (m_MeshSnapshots == nullptr)
+	{
+		return;
+	}
+
+	ChunkMeshSnapshot* freeMeshSnapshot = nullptr;
+	while (m_FreeMeshSnapshots.Pop(freeMeshSnapshot))
+	{
+
+	}
+
+	delete[] m_MeshSnapshots;
+	m_MeshSnapshots = nullptr;
+}
+
+
+
+ChunkMeshSnapshot* ChunkMeshSnapshotPool::AllocateChunkMeshSnapshot()
+{
+	ChunkMeshSnapshot* allocatedMeshSnapshot = nullptr;
+	if (!m_FreeMeshSnapshots.Pop(allocatedMeshSnapshot))
+	{
+		return nullptr;
+	}
+
+	return allocatedMeshSnapshot;
+}
+
+
+
+void ChunkMeshSnapshotPool::DeallocateChunkMeshSnapshot(ChunkMeshSnapshot* currentMeshSnapshot)
+{
+	ASSERT_OR_DIE(currentMeshSnapshot >= m_MeshSnapshots && currentMeshSnapshot < m_MeshSnapshots + CHUNK_MESH_SNAPSHOT_POOL_SIZE, "Chunk mesh snapshot does not belong to this pool.");
+
+	m_FreeMeshSnapshots.Push(currentMeshSnapshot);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/ChunkMeshSnapshot.hpp"
+#include "Game/LockFreeQueue.hpp"
+
+
+
+const size_t CHUNK_MESH_SNAPSHOT_POOL_SIZE = 32U;
+
+
+
+class ChunkMeshSnapshotPool
+{
+public:
+	ChunkMeshSnapshotPool();
+	~ChunkMeshSnapshotPool();
+
+	void InitializeChunkMeshSnapshotPool();
+	void UninitializeChunkMeshSnapshotPool();
+
+	ChunkMeshSnapshot* AllocateChunkMeshSnapshot();
+	void DeallocateChunkMeshSnapshot(ChunkMeshSnapshot* currentMeshSnapshot);
+
+	size_t GetNumberOfFreeChunkMeshSnapshots() const;
+
+private:
+	ChunkMeshSnapshot* m_MeshSnapshots;
+	LockFreeQueue<ChunkMeshSnapshot*, CHUNK_MESH_SNAPSHOT_POOL_SIZE> m_FreeMeshSnapshots;
+};
+
+
+
+inline size_t ChunkMeshSnapshotPool::GetNumberOfFreeChunkMeshSnapshots() const
+{
+	return m_FreeMeshSnapshots.GetSize();
+}
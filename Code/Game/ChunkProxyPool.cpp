@@ -0,0 +1,79 @@
+#include "Game/ChunkProxyPool.hpp"
+
+
+
+ChunkProxyPool::ChunkProxyPool() :
+m_ChunkProxies(nullptr)
+{
+
+}
+
+
+
+ChunkProxyPool::~ChunkProxyPool()
+{
+	UninitializeChunkProxyPool();
+}
+
+
+
+void ChunkProxyPool::InitializeChunkProxyPool()
+{
+	if (m_ChunkProxies != nullptr)
+	{
+		return;
+	}
+
+	m_ChunkProxies = new ChunkProxy[CHUNK_PROXY_POOL_SIZE];
+
+	for (size_t proxyIndex = 0; proxyIndex < CHUNK_PROXY_POOL_SIZE; ++proxyIndex)
+	{
+		m_FreeChunkProxies.Push(&m_ChunkProxies[proxyIndex]);
+	}
+}
+
+
+
+void ChunkProxyPool::UninitializeChunkProxyPool()
+{
+	if (m_ChunkProxies == nullptr)
+	{
+		return;
+	}
+
+	ChunkProxy* freeChunkProxy = nullptr;
+	while (m_FreeChunkProxies.Pop(freeChunkProxy))
+	{
+
+	}
+
+	delete[] m_ChunkProxies;
+	m_ChunkProxies = nullptr;
+}
+
+
+
+ChunkProxy* ChunkProxyPool::AllocateChunkProxy(const IntVector2& chunkCoordinates)
+{
+	ChunkProxy* allocatedChunkProxy = nullptr;
+	if (!m_FreeChunkProxies.Pop(allocatedChunkProxy))
+	{
+		return nullptr;
+	}
+
+	allocatedChunkProxy->m_ChunkCoordinates = chunkCoordinates;
+	allocatedChunkProxy->m_HasInternalLight = false;
+	allocatedChunkProxy->m_IsValid = true;
+
+	return allocatedChunkProxy;
+}
+
+
+
+void ChunkProxyPool::DeallocateChunkProxy(ChunkProxy* currentChunkProxy)
+{
+	ASSERT_OR_DIE(currentChunkProxy >= m_ChunkProxies && currentChunkProxy < m_ChunkProxies + CHUNK_PROXY_POOL_SIZE, "Chunk proxy does not belong to this pool.");
+
+	currentChunkProxy->m_IsValid = false;
+	m_FreeChunkProxies.Push(currentChunkProxy);
+}
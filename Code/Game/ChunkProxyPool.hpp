@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/Chunk.hpp"
+#include "Game/LockFreeQueue.hpp"
+
+
+
+const size_t CHUNK_PROXY_POOL_SIZE = 128U;
+
+
+
+class ChunkProxyPool
+{
+public:
+	ChunkProxyPool();
+	~ChunkProxyPool();
+
+	void InitializeChunkProxyPool();
+	void UninitializeChunkProxyPool();
+
+	ChunkProxy* AllocateChunkProxy(const IntVector2& chunkCoordinates);
+	void DeallocateChunkProxy(ChunkProxy* currentChunkProxy);
+
+	size_t GetNumberOfFreeChunkProxies() const;
+	static size_t GetPoolSizeInBytes();
+
+private:
+	ChunkProxy* m_ChunkProxies;
+	LockFreeQueue<ChunkProxy*, CHUNK_PROXY_POOL_SIZE> m_FreeChunkProxies;
+};
+
+
+
+inline size_t ChunkProxyPool::GetNumberOfFreeChunkProxies() const
+{
+	return m_FreeChunkProxies.GetSize();
+}
+
+
+
+
+inline size_t ChunkProxyPool::GetPoolSizeInBytes()
+{
+	return CHUNK_PROXY_POOL_SIZE * sizeof(ChunkProxy);
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "Game/ChunkQuadIndexBuffer.hpp"
+
+
+
+std::vector<uint32_t> ChunkQuadIndexBuffer::s_QuadIndices;
+
+
+
+void ChunkQuadIndexBuffer::InitializeChunkQuadIndexBuffer()
+{
+	if (!s_QuadIndices.empty())
+	{
+		return;
+	}
+
+	s_QuadIndices.reserve(MAXIMUM_QUADS_PER_CHUNK_MESH * INDICES_PER_QUAD);
+
+	for (size_t quadIndex = 0; quadIndex < MAXIMUM_QUADS_PER_CHUNK_MESH; ++quadIndex)
+	{
+		uint32_t firstVertex = static_cast<uint32_t>(quadIndex * VERTICES_PER_QUAD);
+		uint32_t quadIndices[INDICES_PER_QUAD] = { firstVertex + 0, firstVertex + 1, firstVertex + 2, firstVertex + 0, firstVertex + 2, firstVertex + 3 };
+
+		for (size_t cornerIndex = 0; cornerIndex < INDICES_PER_QUAD; ++cornerIndex)
+		{
+			s_QuadIndices.push_back(quadIndices[cornerIndex]);
+		}
+	}
+}
\ No newline at end of file
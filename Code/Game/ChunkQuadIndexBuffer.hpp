@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/ChunkMeshSnapshot.hpp"
+
+
+
+const size_t VERTICES_PER_QUAD = 4U;
+const size_t INDICES_PER_QUAD = 6U;
+const size_t MAXIMUM_QUADS_PER_CHUNK_MESH = (NUMBER_OF_BLOCKS_PER_CHUNK / 2) * NUMBER_OF_BLOCK_FACES;
+
+
+
+class ChunkQuadIndexBuffer
+{
+public:
+	static void InitializeChunkQuadIndexBuffer();
+
+	static size_t GetNumberOfIndicesForVertices(size_t numberOfVertices);
+
+public:
+	static std::vector<uint32_t> s_QuadIndices;
+};
+
+
+
+inline size_t ChunkQuadIndexBuffer::GetNumberOfIndicesForVertices(size_t numberOfVertices)
+{
+	return (numberOfVertices / VERTICES_PER_QUAD) * INDICES_PER_QUAD;
+}
\ No newline at end of file
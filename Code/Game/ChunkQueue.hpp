@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/Chunk.hpp"
+#include "Game/LockFreeQueue.hpp"
+
+
+
+const size_t CHUNK_QUEUE_CAPACITY = 1024U;
+
+
+
+struct ChunkRequest
+{
+	IntVector2 m_ChunkCoordinates;
+	ChunkProxy* m_ChunkProxy;
+	ChunkMeshSnapshot* m_MeshSnapshot;
+	uint32_t m_MeshRevision;
+	float m_Priority;
+	double m_RequestTimeInSeconds;
+	bool m_IsCancelled;
+
+	ChunkRequest() :
+	m_ChunkCoordinates(IntVector2::ZERO),
+	m_ChunkProxy(nullptr),
+	m_MeshSnapshot(nullptr),
+	m_MeshRevision(0U),
+	m_Priority(0.0f),
+	m_RequestTimeInSeconds(0.0),
+	m_IsCancelled(false)
+	{
+
+	}
+
+	ChunkRequest(const IntVector2& chunkCoordinates, ChunkProxy* chunkProxy, float priority) :
+	m_ChunkCoordinates(chunkCoordinates),
+	m_ChunkProxy(chunkProxy),
+	m_MeshSnapshot(nullptr),
+	m_MeshRevision(0U),
+	m_Priority(priority),
+	m_RequestTimeInSeconds(GetCurrentTimeInSeconds()),
+	m_IsCancelled(false)
+	{
+
+	}
+
+	ChunkRequest(const IntVector2& chunkCoordinates, ChunkMeshSnapshot* meshSnapshot, uint32_t meshRevision, float priority) :
+	m_ChunkCoordinates(chunkCoordinates),
+	m_ChunkProxy(nullptr),
+	m_MeshSnapshot(meshSnapshot),
+	m_MeshRevision(meshRevision),
+	m_Priority(priority),
+	m_RequestTimeInSeconds(GetCurrentTimeInSeconds()),
+	m_IsCancelled(false)
+	{
+
+	}
+};
+
+
+
+class ChunkQueueStatistics
+{
+public:
+	ChunkQueueStatistics();
+
+	void RecordQueueDepth(size_t queueDepth);
+	void RecordCompletedRequest(const ChunkRequest& completedRequest);
+	void RecordCancelledRequest();
+
+	size_t GetQueueDepth() const;
+	size_t GetMaximumQueueDepth() const;
+	size_t GetNumberOfCompletedRequests() const;
+	size_t GetNumberOfCancelledRequests() const;
+	double GetAverageLatencyInMilliseconds() const;
+	double GetMaximumLatencyInMilliseconds() const;
+
+private:
+	std::atomic<size_t> m_QueueDepth;
+	std::atomic<size_t> m_MaximumQueueDepth;
+	std::atomic<size_t> m_NumberOfCompletedRequests;
+	std::atomic<size_t> m_NumberOfCancelledRequests;
+	std::atomic<uint64_t> m_TotalLatencyInMicroseconds;
+	std::atomic<uint64_t> m_MaximumLatencyInMicroseconds;
+};
+
+
+
+typedef LockFreeQueue<ChunkRequest, CHUNK_QUEUE_CAPACITY> ChunkQueue;
+
+
+
+inline ChunkQueueStatistics::ChunkQueueStatistics() :
+m_QueueDepth(0U),
+m_MaximumQueueDepth(0U),
+m_NumberOfCompletedRequests(0U),
+m_NumberOfCancelledRequests(0U),
+m_TotalLatencyInMicroseconds(0U),
+m_MaximumLatencyInMicroseconds(0U)
+{
+
+}
+
+
+
+inline void ChunkQueueStatistics::RecordQueueDepth(size_t queueDepth)
+{
+	m_QueueDepth.store(queueDepth, std::memory_order_relaxed);
+
+	size_t maximumQueueDepth = m_MaximumQueueDepth.load(std::memory_order_relaxed);
+	while (queueDepth > maximumQueueDepth && !m_MaximumQueueDepth.compare_exchange_weak(maximumQueueDepth, queueDepth, std::memory_order_relaxed))
+	{
+
+	}
+}
+
+
+
+inline void ChunkQueueStatistics::RecordCompletedRequest(const ChunkRequest& completedRequest)
+{
+	double latencyInSeconds = GetCurrentTimeInSeconds() - completedRequest.m_RequestTimeInSeconds;
+	uint64_t latencyInMicroseconds = static_cast<uint64_t>(latencyInSeconds * 1000000.0);
+
+	m_NumberOfCompletedRequests.fetch_add(1U, std::memory_order_relaxed);
+	m_TotalLatencyInMicroseconds.fetch_add(latencyInMicroseconds, std::memory_order_relaxed);
+
+	uint64_t maximumLatencyInMicroseconds = m_MaximumLatencyInMicroseconds.load(std::memory_order_relaxed);
+	while (latencyInMicroseconds > maximumLatencyInMicroseconds && !m_MaximumLatencyInMicroseconds.compare_exchange_weak(maximumLatencyInMicroseconds, latencyInMicroseconds, std::memory_order_relaxed))
+	{
+
+	}
+}
+
+
+
+inline void ChunkQueueStatistics::RecordCancelledRequest()
+{
+	m_NumberOfCancelledRequests.fetch_add(1U, std::memory_order_relaxed);
+}
+
+
+
+inline size_t ChunkQueueStatistics::GetQueueDepth() const
+{
+	return m_QueueDepth.load(std::memory_order_relaxed);
+}
+
+
+
+inline size_t ChunkQueueStatistics::GetMaximumQueueDepth() const
+{
+	return m_MaximumQueueDepth.load(std::memory_order_relaxed);
+}
+
+
+
+inline size_t ChunkQueueStatistics::GetNumberOfCompletedRequests() const
+{
+	return m_NumberOfCompletedRequests.load(std::memory_order_relaxed);
+}
+
+
+
+inline size_t ChunkQueueStatistics::GetNumberOfCancelledRequests() const
+{
+	return m_NumberOfCancelledRequests.load(std::memory_order_relaxed);
+}
+
+
+
+inline double ChunkQueueStatistics::GetAverageLatencyInMilliseconds() const
+{
+	size_t numberOfCompletedRequests = GetNumberOfCompletedRequests();
+	if (numberOfCompletedRequests == 0U)
+	{
+		return 0.0;
+	}
+
+	uint64_t totalLatencyInMicroseconds = m_TotalLatencyInMicroseconds.load(std::memory_order_relaxed);
+
+	return (static_cast<double>(totalLatencyInMicroseconds) * 0.001) / static_cast<double>(numberOfCompletedRequests);
+}
+
+
+
+inline double ChunkQueueStatistics::GetMaximumLatencyInMilliseconds() const
+{
+	uint64_t maximumLatencyInMicroseconds = m_MaximumLatencyInMicroseconds.load(std::memory_order_relaxed);
+
+	return static_cast<double>(maximumLatencyInMicroseconds) * 0.001;
+}
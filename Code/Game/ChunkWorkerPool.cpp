@@ -0,0 +1,384 @@
+#include "Game/ChunkWorkerPool.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <thread>
+
+
+
+struct ChunkWorker
+{
+	CRITICAL_SECTION m_JobCriticalSection;
+	std::vector<ChunkJob> m_Jobs;
+};
+
+
+
+struct ChunkWorkerSignals
+{
+	HANDLE m_WorkAvailableSemaphore;
+	HANDLE m_AllWorkersStoppedEvent;
+};
+
+
+
+struct ChunkPendingSaves
+{
+	CRITICAL_SECTION m_PendingSaveCriticalSection;
+	std::vector<ChunkJob> m_ParkedJobs[NUMBER_OF_PENDING_SAVE_BUCKETS];
+};
+
+
+
+ChunkWorkerPool::ChunkWorkerPool() :
+m_Workers(nullptr),
+m_Signals(nullptr),
+m_PendingSaves(nullptr),
+m_NumberOfWorkers(0U),
+m_IsShuttingDown(false),
+m_NumberOfRunningWorkers(0U),
+m_NumberOfQueuedJobs(0U),
+m_NumberOfStreamingCentres(0U)
+{
+	for (size_t bucketIndex = 0; bucketIndex < NUMBER_OF_PENDING_SAVE_BUCKETS; ++bucketIndex)
+	{
+		m_PendingSaveCounts[bucketIndex].store(0, std::memory_order_relaxed);
+	}
+
+	for (size_t centreIndex = 0; centreIndex < MAXIMUM_NUMBER_OF_STREAMING_CENTRES; ++centreIndex)
+	{
+		m_StreamingCentresX[centreIndex].store(0, std::memory_order_relaxed);
+		m_StreamingCentresY[centreIndex].store(0, std::memory_order_relaxed);
+	}
+}
+
+
+
+ChunkWorkerPool::~ChunkWorkerPool()
+{
+	UninitializeWorkerPool();
+}
+
+
+
+void ChunkWorkerPool::InitializeWorkerPool(size_t numberOfWorkers)
+{
+	if (m_Workers != nullptr)
+	{
+		return;
+	}
+
+	m_NumberOfWorkers = numberOfWorkers;
+	m_Workers = new ChunkWorker[m_NumberOfWorkers];
+
+	for (size_t workerIndex = 0; workerIndex < m_NumberOfWorkers; ++workerIndex)
+	{
+		InitializeCriticalSection(&m_Workers[workerIndex].m_JobCriticalSection);
+		m_Workers[workerIndex].m_Jobs.reserve(MAXIMUM_NUMBER_OF_CHUNKS);
+	}
+
+	m_Signals = new ChunkWorkerSignals();
+	m_Signals->m_WorkAvailableSemaphore = CreateSemaphore(nullptr, 0, MAXLONG, nullptr);
+	m_Signals->m_AllWorkersStoppedEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+
+	m_PendingSaves = new ChunkPendingSaves();
+	InitializeCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+
+	m_IsShuttingDown.store(false, std::memory_order_release);
+	m_NumberOfRunningWorkers.store(m_NumberOfWorkers, std::memory_order_release);
+}
+
+
+
+void ChunkWorkerPool::UninitializeWorkerPool()
+{
+	if (m_Workers == nullptr)
+	{
+		return;
+	}
+
+	for (size_t workerIndex = 0; workerIndex < m_NumberOfWorkers; ++workerIndex)
+	{
+		DeleteCriticalSection(&m_Workers[workerIndex].m_JobCriticalSection);
+	}
+
+	delete[] m_Workers;
+	m_Workers = nullptr;
+
+	CloseHandle(m_Signals->m_WorkAvailableSemaphore);
+	CloseHandle(m_Signals->m_AllWorkersStoppedEvent);
+
+	delete m_Signals;
+	m_Signals = nullptr;
+
+	DeleteCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+
+	delete m_PendingSaves;
+	m_PendingSaves = nullptr;
+
+	m_NumberOfWorkers = 0U;
+	m_NumberOfQueuedJobs.store(0U, std::memory_order_relaxed);
+}
+
+
+
+void ChunkWorkerPool::AddJob(size_t workerIndex, const ChunkJob& currentJob)
+{
+	ChunkWorker& currentWorker = m_Workers[workerIndex];
+
+	EnterCriticalSection(&currentWorker.m_JobCriticalSection);
+	{
+		currentWorker.m_Jobs.push_back(currentJob);
+	}
+	LeaveCriticalSection(&currentWorker.m_JobCriticalSection);
+
+	m_NumberOfQueuedJobs.fetch_add(1U, std::memory_order_relaxed);
+}
+
+
+
+bool ChunkWorkerPool::TakeJob(size_t workerIndex, ChunkJob& currentJob)
+{
+	if (TakeMostUrgentJob(m_Workers[workerIndex], currentJob))
+	{
+		return true;
+	}
+
+	for (size_t victimOffset = 1; victimOffset < m_NumberOfWorkers; ++victimOffset)
+	{
+		size_t victimIndex = (workerIndex + victimOffset) % m_NumberOfWorkers;
+		if (TakeMostUrgentJob(m_Workers[victimIndex], currentJob))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+bool ChunkWorkerPool::TakeMostUrgentJob(ChunkWorker& currentWorker, ChunkJob& currentJob)
+{
+	bool jobFound = false;
+
+	EnterCriticalSection(&currentWorker.m_JobCriticalSection);
+	{
+		size_t numberOfJobs = currentWorker.m_Jobs.size();
+		if (numberOfJobs > 0U)
+		{
+			size_t mostUrgentJobIndex = 0U;
+			for (size_t jobIndex = 1; jobIndex < numberOfJobs; ++jobIndex)
+			{
+				if (currentWorker.m_Jobs[jobIndex].IsMoreUrgentThan(currentWorker.m_Jobs[mostUrgentJobIndex]))
+				{
+					mostUrgentJobIndex = jobIndex;
+				}
+			}
+
+			currentJob = currentWorker.m_Jobs[mostUrgentJobIndex];
+			currentWorker.m_Jobs[mostUrgentJobIndex] = currentWorker.m_Jobs.back();
+			currentWorker.m_Jobs.pop_back();
+
+			jobFound = true;
+		}
+	}
+	LeaveCriticalSection(&currentWorker.m_JobCriticalSection);
+
+	if (jobFound)
+	{
+		m_NumberOfQueuedJobs.fetch_sub(1U, std::memory_order_relaxed);
+	}
+
+	return jobFound;
+}
+
+
+
+void ChunkWorkerPool::SignalWorkIsAvailable()
+{
+	ReleaseSemaphore(m_Signals->m_WorkAvailableSemaphore, 1, nullptr);
+}
+
+
+
+void ChunkWorkerPool::WaitForWork()
+{
+	WaitForSingleObject(m_Signals->m_WorkAvailableSemaphore, INFINITE);
+}
+
+
+
+void ChunkWorkerPool::RequestShutdown()
+{
+	m_IsShuttingDown.store(true, std::memory_order_release);
+	ReleaseSemaphore(m_Signals->m_WorkAvailableSemaphore, static_cast<LONG>(m_NumberOfWorkers), nullptr);
+}
+
+
+
+void ChunkWorkerPool::MarkWorkerAsStopped()
+{
+	if (m_NumberOfRunningWorkers.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+	{
+		SetEvent(m_Signals->m_AllWorkersStoppedEvent);
+	}
+}
+
+
+
+void ChunkWorkerPool::WaitForAllWorkersToStop()
+{
+	if (m_NumberOfRunningWorkers.load(std::memory_order_acquire) > 0U)
+	{
+		WaitForSingleObject(m_Signals->m_AllWorkersStoppedEvent, INFINITE);
+	}
+}
+
+
+
+void ChunkWorkerPool::MarkSaveAsPending(const IntVector2& chunkCoordinates)
+{
+	size_t bucketIndex = GetPendingSaveBucketForChunkCoordinates(chunkCoordinates);
+	m_PendingSaveCounts[bucketIndex].fetch_add(1, std::memory_order_acq_rel);
+}
+
+
+
+void ChunkWorkerPool::MarkSaveAsCompleted(const IntVector2& chunkCoordinates)
+{
+	size_t bucketIndex = GetPendingSaveBucketForChunkCoordinates(chunkCoordinates);
+	std::vector<ChunkJob> unparkedJobs;
+
+	EnterCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+	{
+		if (m_PendingSaveCounts[bucketIndex].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			unparkedJobs.swap(m_PendingSaves->m_ParkedJobs[bucketIndex]);
+		}
+	}
+	LeaveCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+
+	if (unparkedJobs.empty())
+	{
+		return;
+	}
+
+	size_t workerIndex = bucketIndex % m_NumberOfWorkers;
+	for (const ChunkJob& unparkedJob : unparkedJobs)
+	{
+		AddJob(workerIndex, unparkedJob);
+		SignalWorkIsAvailable();
+	}
+}
+
+
+
+bool ChunkWorkerPool::ParkJobBehindPendingSave(const ChunkJob& currentJob)
+{
+	size_t bucketIndex = GetPendingSaveBucketForChunkCoordinates(currentJob.m_Request.m_ChunkCoordinates);
+	bool jobParked = false;
+
+	EnterCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+	{
+		if (m_PendingSaveCounts[bucketIndex].load(std::memory_order_acquire) > 0)
+		{
+			m_PendingSaves->m_ParkedJobs[bucketIndex].push_back(currentJob);
+			jobParked = true;
+		}
+	}
+	LeaveCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+
+	return jobParked;
+}
+
+
+
+bool ChunkWorkerPool::TakeRemainingJob(ChunkJob& currentJob)
+{
+	ASSERT_OR_DIE(m_NumberOfRunningWorkers.load(std::memory_order_acquire) == 0U, "Chunk Worker Pool Error.");
+
+	if (m_Workers == nullptr)
+	{
+		return false;
+	}
+
+	if (TakeJob(0U, currentJob))
+	{
+		return true;
+	}
+
+	bool jobFound = false;
+
+	EnterCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+	{
+		for (size_t bucketIndex = 0; bucketIndex < NUMBER_OF_PENDING_SAVE_BUCKETS; ++bucketIndex)
+		{
+			std::vector<ChunkJob>& parkedJobs = m_PendingSaves->m_ParkedJobs[bucketIndex];
+			if (!parkedJobs.empty())
+			{
+				currentJob = parkedJobs.back();
+				parkedJobs.pop_back();
+				jobFound = true;
+				break;
+			}
+		}
+	}
+	LeaveCriticalSection(&m_PendingSaves->m_PendingSaveCriticalSection);
+
+	return jobFound;
+}
+
+
+
+void ChunkWorkerPool::SetStreamingCentres(const IntVector2* streamingCentres, size_t numberOfStreamingCentres)
+{
+	if (numberOfStreamingCentres > MAXIMUM_NUMBER_OF_STREAMING_CENTRES)
+	{
+		numberOfStreamingCentres = MAXIMUM_NUMBER_OF_STREAMING_CENTRES;
+	}
+
+	for (size_t centreIndex = 0; centreIndex < numberOfStreamingCentres; ++centreIndex)
+	{
+		m_StreamingCentresX[centreIndex].store(streamingCentres[centreIndex].X, std::memory_order_relaxed);
+		m_StreamingCentresY[centreIndex].store(streamingCentres[centreIndex].Y, std::memory_order_relaxed);
+	}
+
+	m_NumberOfStreamingCentres.store(numberOfStreamingCentres, std::memory_order_release);
+}
+
+
+
+bool ChunkWorkerPool::ChunkIsBeyondFlushRadius(const IntVector2& chunkCoordinates) const
+{
+	size_t numberOfStreamingCentres = m_NumberOfStreamingCentres.load(std::memory_order_acquire);
+	if (numberOfStreamingCentres == 0U)
+	{
+		return false;
+	}
+
+	int squaredFlushRadius = FLUSH_CHUNK_RADIUS * FLUSH_CHUNK_RADIUS;
+
+	for (size_t centreIndex = 0; centreIndex < numberOfStreamingCentres; ++centreIndex)
+	{
+		int offsetX = chunkCoordinates.X - m_StreamingCentresX[centreIndex].load(std::memory_order_relaxed);
+		int offsetY = chunkCoordinates.Y - m_StreamingCentresY[centreIndex].load(std::memory_order_relaxed);
+
+		if ((offsetX * offsetX) + (offsetY * offsetY) <= squaredFlushRadius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+size_t ChunkWorkerPool::GetIdealNumberOfWorkers()
+{
+	size_t numberOfHardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+	size_t numberOfWorkers = (numberOfHardwareThreads > 1U) ? (numberOfHardwareThreads - 1U) : 1U;
+
+	return (numberOfWorkers < MAXIMUM_NUMBER_OF_CHUNK_WORKERS) ? numberOfWorkers : MAXIMUM_NUMBER_OF_CHUNK_WORKERS;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/ChunkQueue.hpp"
+
+
+
+const size_t MAXIMUM_NUMBER_OF_CHUNK_WORKERS = 16U;
+const size_t MAXIMUM_NUMBER_OF_STREAMING_CENTRES = 2U;
+const size_t PENDING_SAVE_BUCKET_BITS = 10U;
+const size_t NUMBER_OF_PENDING_SAVE_BUCKETS = 1U << PENDING_SAVE_BUCKET_BITS;
+
+
+
+enum ChunkJobType : uint8_t
+{
+	SAVE_CHUNK_JOB,
+	MESH_CHUNK_JOB,
+	LOAD_CHUNK_JOB,
+	NUMBER_OF_CHUNK_JOB_TYPES
+};
+
+
+
+struct ChunkJob
+{
+	ChunkJobType m_JobType;
+	ChunkRequest m_Request;
+
+	ChunkJob() :
+	m_JobType(LOAD_CHUNK_JOB),
+	m_Request(ChunkRequest())
+	{
+
+	}
+
+	ChunkJob(ChunkJobType jobType, const ChunkRequest& currentRequest) :
+	m_JobType(jobType),
+	m_Request(currentRequest)
+	{
+
+	}
+
+	bool IsMoreUrgentThan(const ChunkJob& otherJob) const;
+};
+
+
+
+struct ChunkWorker;
+struct ChunkWorkerSignals;
+struct ChunkPendingSaves;
+
+
+
+class ChunkWorkerPool
+{
+public:
+	ChunkWorkerPool();
+	~ChunkWorkerPool();
+
+	void InitializeWorkerPool(size_t numberOfWorkers);
+	void UninitializeWorkerPool();
+
+	void AddJob(size_t workerIndex, const ChunkJob& currentJob);
+	bool TakeJob(size_t workerIndex, ChunkJob& currentJob);
+
+	void SignalWorkIsAvailable();
+	void WaitForWork();
+
+	void RequestShutdown();
+	bool IsShuttingDown() const;
+	void MarkWorkerAsStopped();
+	void WaitForAllWorkersToStop();
+
+	void MarkSaveAsPending(const IntVector2& chunkCoordinates);
+	void MarkSaveAsCompleted(const IntVector2& chunkCoordinates);
+	bool ParkJobBehindPendingSave(const ChunkJob& currentJob);
+	bool TakeRemainingJob(ChunkJob& currentJob);
+
+	void SetStreamingCentres(const IntVector2* streamingCentres, size_t numberOfStreamingCentres);
+	bool ChunkIsBeyondFlushRadius(const IntVector2& chunkCoordinates) const;
+
+	size_t GetNumberOfWorkers() const;
+	size_t GetNumberOfQueuedJobs() const;
+
+	static size_t GetIdealNumberOfWorkers();
+
+private:
+	bool TakeMostUrgentJob(ChunkWorker& currentWorker, ChunkJob& currentJob);
+	size_t GetPendingSaveBucketForChunkCoordinates(const IntVector2& chunkCoordinates) const;
+
+private:
+	ChunkWorker* m_Workers;
+	ChunkWorkerSignals* m_Signals;
+	ChunkPendingSaves* m_PendingSaves;
+	size_t m_NumberOfWorkers;
+
+	std::atomic<bool> m_IsShuttingDown;
+	std::atomic<size_t> m_NumberOfRunningWorkers;
+
+	std::atomic<size_t> m_NumberOfQueuedJobs;
+	std::atomic<int> m_PendingSaveCounts[NUMBER_OF_PENDING_SAVE_BUCKETS];
+
+	std::atomic<int> m_StreamingCentresX[MAXIMUM_NUMBER_OF_STREAMING_CENTRES];
+	std::atomic<int> m_StreamingCentresY[MAXIMUM_NUMBER_OF_STREAMING_CENTRES];
+	std::atomic<size_t> m_NumberOfStreamingCentres;
+};
+
+
+
+inline bool ChunkJob::IsMoreUrgentThan(const ChunkJob& otherJob) const
+{
+	if (m_JobType != otherJob.m_JobType)
+	{
+		return m_JobType < otherJob.m_JobType;
+	}
+
+	return m_Request.m_Priority < otherJob.m_Request.m_Priority;
+}
+
+
+
+inline bool ChunkWorkerPool::IsShuttingDown() const
+{
+	return m_IsShuttingDown.load(std::memory_order_acquire);
+}
+
+
+
+inline size_t ChunkWorkerPool::GetNumberOfWorkers() const
+{
+	return m_NumberOfWorkers;
+}
+
+
+
+inline size_t ChunkWorkerPool::GetNumberOfQueuedJobs() const
+{
+	return m_NumberOfQueuedJobs.load(std::memory_order_relaxed);
+}
+
+
+
+inline size_t ChunkWorkerPool::GetPendingSaveBucketForChunkCoordinates(const IntVector2& chunkCoordinates) const
+{
+	return static_cast<size_t>(Chunk::HashChunkCoordinates(chunkCoordinates) >> (32U - PENDING_SAVE_BUCKET_BITS));
+}
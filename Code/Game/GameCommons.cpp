@@ -7,5 +7,7 @@ bool g_TwoPlayerMode = false;
 bool g_DebugMode = false;
 bool g_ScreenshotMode = false;
 bool g_LoadGame = false;
+bool g_GreedyMeshing = false;
+bool g_PalettedBlockStorage = false;
 
 bool g_IsQuitting = false;
\ No newline at end of file
@@ -36,6 +36,8 @@ extern bool g_TwoPlayerMode;
 extern bool g_DebugMode;
 extern bool g_ScreenshotMode;
 extern bool g_LoadGame;
+extern bool g_GreedyMeshing;
+extern bool g_PalettedBlockStorage;
 
 extern bool g_IsQuitting;
 
@@ -71,6 +73,14 @@ const int BLOCKS_X_MASK = NUMBER_OF_BLOCKS_X - 1;
 const int BLOCKS_Y_MASK = NUMBER_OF_BLOCKS_Y - 1;
 const int BLOCKS_Z_MASK = NUMBER_OF_BLOCKS_Z - 1;
 
+const int SECTION_BITS_Z = 4;
+const int BLOCK_BITS_PER_SECTION = BLOCK_BITS_PER_LAYER + SECTION_BITS_Z;
+const int NUMBER_OF_BLOCKS_PER_SECTION_Z = 1 << SECTION_BITS_Z;
+const int NUMBER_OF_BLOCKS_PER_SECTION = 1 << BLOCK_BITS_PER_SECTION;
+const int NUMBER_OF_SECTIONS = NUMBER_OF_BLOCKS_Z >> SECTION_BITS_Z;
+const int SECTION_Z_MASK = NUMBER_OF_BLOCKS_PER_SECTION_Z - 1;
+const uint8_t ALL_SECTIONS_MASK = 0xFF;
+
 
 
 const float BLOCK_WIDTH = 1.0f;
@@ -94,6 +104,25 @@ const float SQUARED_ACTIVATION_DISTANCE = ACTIVATION_DISTANCE * ACTIVATION_DISTA
 const float FLUSHING_DISTANCE = static_cast<float>(FLUSH_CHUNK_RADIUS)* 16.0f;
 const float SQUARED_FLUSHING_DISTANCE = FLUSHING_DISTANCE * FLUSHING_DISTANCE;
 
+const size_t MAXIMUM_CHUNK_ACTIVATIONS_PER_FRAME = 8U;
+const double CHUNK_ACTIVATION_BUDGET_IN_MICROSECONDS = 2000.0;
+const size_t CHUNK_ACTIVATION_WINDOW_SIZE = 64U;
+
+const float VIEW_DIRECTION_PRIORITY_WEIGHT = 0.35f;
+const float MOVEMENT_DIRECTION_PRIORITY_WEIGHT = 0.35f;
+const float CHUNK_PREFETCH_TIME_IN_SECONDS = 1.0f;
+const int MAXIMUM_CHUNK_PREFETCH_DISTANCE = FLUSH_CHUNK_RADIUS - ACTIVE_CHUNK_RADIUS - 1;
+
+const double MESH_REBUILD_BUDGET_IN_MICROSECONDS = 2000.0;
+const float OFF_SCREEN_REBUILD_PRIORITY_SCALE = 4.0f;
+const float URGENT_REBUILD_PRIORITY = -1.0f;
+const size_t URGENT_MESH_SNAPSHOT_RESERVE = 2U;
+const size_t SCRATCH_ARENA_WARM_UP_REBUILDS = 256U;
+
+const double LIGHTING_BUDGET_IN_MICROSECONDS = 2000.0;
+const size_t MAXIMUM_LIGHT_UPDATES_PER_FRAME = 65536U;
+const int LIGHTING_COMPARISON_COLUMN_STRIDE = 7;
+
 
 
 const float VIEW_WIDTH = 16.0f;
@@ -103,6 +132,7 @@ const float MAXIMUM_CAMERA_HEIGHT = static_cast<float>(NUMBER_OF_BLOCKS_Z) - 0.5
 const float MINIMUM_CAMERA_HEIGHT = 1.5f;
 const Vector3 EYE_LEVEL_VIEW = Vector3(0.0f, 0.0f, 0.69f);
 const float DAY_DURATION_IN_MINUTES = 20.0f;
+const float MINIMUM_SKY_LIGHT_INTENSITY = 0.2f;
 const float WATER_LEVEL = static_cast<float>(NUMBER_OF_BLOCKS_Z / 2) - 0.25f * BLOCK_HEIGHT;
 const float WATER_RIPPLE_SPEED = 0.025f;
 
@@ -139,7 +169,6 @@ const float ENEMY_RATE_OF_FIRE = 0.25f;
 
 const unsigned char SKY_LIGHT_VALUE = 15;
 
-const unsigned char LIGHT_VALUE_MASK = 0x0F;
-const unsigned char SKY_FLAG_MASK = 0x80;
-const unsigned char LIGHTING_DIRTY_MASK = 0x40;
+const unsigned char LIGHT_CHANNEL_MASK = 0x0F;
+const int LIGHT_CHANNEL_BITS = 4;
 const unsigned char OPACITY_MASK = 0x20;
\ No newline at end of file
@@ -0,0 +1,683 @@
+#include "Game/LightingEngine.hpp"
+
+#include <algorithm>
+#include <functional>
+
+
+
+LightingEngine::LightingEngine() :
+m_NextSequenceNumber(0U),
+m_NumberOfPriorityChunks(0U),
+m_NumberOfProcessedLightChanges(0U)
+{
+
+}
+
+
+
+void LightingEngine::MarkBlockForRelighting(BlockInfo currentBlockInfo)
+{
+	if (currentBlockInfo.GetChunk() == nullptr)
+	{
+		return;
+	}
+
+	for (uint8_t lightChannel = 0; lightChannel < NUMBER_OF_LIGHT_CHANNELS; ++lightChannel)
+	{
+		PushLightUpdate(currentBlockInfo, lightChannel, true);
+	}
+}
+
+
+
+void LightingEngine::MarkColumnForRelighting(BlockInfo currentBlockInfo, int previousColumnHeight)
+{
+	Chunk* currentChunk = currentBlockInfo.GetChunk();
+	int currentBlockIndex = currentBlockInfo.GetBlockIndex();
+
+	int columnIndex = currentChunk->GetColumnIndexForLocalIndex(currentBlockIndex);
+	int currentColumnHeight = currentChunk->GetColumnHeight(columnIndex);
+	int columnBottomHeight = (previousColumnHeight < currentColumnHeight) ? previousColumnHeight : currentColumnHeight;
+	int columnBottomIndex = (columnBottomHeight << BLOCK_BITS_PER_LAYER) + columnIndex;
+
+	if (currentBlockIndex >= columnBottomIndex)
+	{
+		for (int newBlockIndex = currentBlockIndex; newBlockIndex >= columnBottomIndex; newBlockIndex -= NUMBER_OF_BLOCKS_PER_LAYER)
+		{
+			MarkBlockForRelighting(BlockInfo(currentChunk, newBlockIndex));
+		}
+	}
+	else
+	{
+		MarkBlockForRelighting(currentBlockInfo);
+	}
+}
+
+
+
+void LightingEngine::StitchLightAcrossChunkBorders(Chunk* currentChunk)
+{
+	bool easternBorderIsConnected = (currentChunk->m_EasternNeighbour != nullptr && currentChunk->m_EasternNeighbour->IsPopulated());
+	bool westernBorderIsConnected = (currentChunk->m_WesternNeighbour != nullptr && currentChunk->m_WesternNeighbour->IsPopulated());
+	bool northernBorderIsConnected = (currentChunk->m_NorthernNeighbour != nullptr && currentChunk->m_NorthernNeighbour->IsPopulated());
+	bool southernBorderIsConnected = (currentChunk->m_SouthernNeighbour != nullptr && currentChunk->m_SouthernNeighbour->IsPopulated());
+
+	for (int blockIndexZ = 0; blockIndexZ < NUMBER_OF_BLOCKS_Z; ++blockIndexZ)
+	{
+		uint8_t sectionBlockType = currentChunk->GetSectionBlockType(blockIndexZ >> SECTION_BITS_Z);
+		if (sectionBlockType != INVALID_BLOCK)
+		{
+			if (BlockDefinition::IsOpaque(sectionBlockType) && !BlockDefinition::IsEmissive(sectionBlockType))
+			{
+				blockIndexZ |= SECTION_Z_MASK;
+				continue;
+			}
+		}
+
+		for (int borderOffset = 0; borderOffset < NUMBER_OF_BLOCKS_X; ++borderOffset)
+		{
+			if (easternBorderIsConnected)
+			{
+				MarkBorderBlockForStitching(currentChunk, IntVector3(BLOCKS_X_MASK, borderOffset, blockIndexZ));
+			}
+			if (westernBorderIsConnected)
+			{
+				MarkBorderBlockForStitching(currentChunk, IntVector3(0, borderOffset, blockIndexZ));
+			}
+			if (northernBorderIsConnected)
+			{
+				MarkBorderBlockForStitching(currentChunk, IntVector3(borderOffset, BLOCKS_Y_MASK, blockIndexZ));
+			}
+			if (southernBorderIsConnected)
+			{
+				MarkBorderBlockForStitching(currentChunk, IntVector3(borderOffset, 0, blockIndexZ));
+			}
+		}
+	}
+}
+
+
+
+void LightingEngine::SetPriorityChunkCoordinates(const IntVector2* priorityChunkCoordinates, size_t numberOfPriorityChunks)
+{
+	ASSERT_OR_DIE(numberOfPriorityChunks <= MAXIMUM_NUMBER_OF_PRIORITY_CHUNKS, "Lighting Priority Error.");
+
+	bool priorityChunksHaveChanged = (numberOfPriorityChunks != m_NumberOfPriorityChunks);
+	for (size_t priorityIndex = 0; priorityIndex < numberOfPriorityChunks; ++priorityIndex)
+	{
+		if (m_PriorityChunkCoordinates[priorityIndex] != priorityChunkCoordinates[priorityIndex])
+		{
+			priorityChunksHaveChanged = true;
+		}
+
+		m_PriorityChunkCoordinates[priorityIndex] = priorityChunkCoordinates[priorityIndex];
+	}
+
+	m_NumberOfPriorityChunks = numberOfPriorityChunks;
+
+	if (!priorityChunksHaveChanged)
+	{
+		return;
+	}
+
+	for (LightUpdateNode& updateNode : m_LightUpdateHeap)
+	{
+		updateNode.m_Priority = GetPriorityForChunk(updateNode.m_BlockInfo.GetChunk());
+	}
+
+	std::make_heap(m_LightUpdateHeap.begin(), m_LightUpdateHeap.end(), std::greater<LightUpdateNode>());
+}
+
+
+
+void LightingEngine::PropagateLightChanges(double budgetInSeconds, size_t maximumNumberOfLightUpdates)
+{
+	double propagationStartTime = GetCurrentTimeInSeconds();
+	m_NumberOfProcessedLightChanges = 0U;
+
+	while (m_NumberOfProcessedLightChanges < maximumNumberOfLightUpdates)
+	{
+		if (m_NumberOfProcessedLightChanges > 0U && (m_NumberOfProcessedLightChanges % LIGHTING_BUDGET_CHECK_INTERVAL) == 0U)
+		{
+			if (GetCurrentTimeInSeconds() - propagationStartTime > budgetInSeconds)
+			{
+				break;
+			}
+		}
+
+		if (!m_LightRemovalQueue.empty())
+		{
+			LightRemovalNode removalNode = m_LightRemovalQueue.front();
+			m_LightRemovalQueue.pop_front();
+			ProcessLightRemoval(removalNode);
+		}
+		else if (!m_LightUpdateHeap.empty())
+		{
+			std::pop_heap(m_LightUpdateHeap.begin(), m_LightUpdateHeap.end(), std::greater<LightUpdateNode>());
+			LightUpdateNode updateNode = m_LightUpdateHeap.back();
+			m_LightUpdateHeap.pop_back();
+
+			if (updateNode.m_NeedsRelighting)
+			{
+				RelightBlock(updateNode.m_BlockInfo, updateNode.m_LightChannel);
+			}
+			else
+			{
+				ProcessLightPropagation(updateNode.m_BlockInfo, updateNode.m_LightChannel);
+			}
+		}
+		else
+		{
+			break;
+		}
+
+		++m_NumberOfProcessedLightChanges;
+	}
+}
+
+
+
+void LightingEngine::DiscardLightChangesForChunk(Chunk* currentChunk)
+{
+	for (std::deque<LightRemovalNode>::iterator nodeIterator = m_LightRemovalQueue.begin(); nodeIterator != m_LightRemovalQueue.end();)
+	{
+		if (nodeIterator->m_BlockInfo.GetChunk() == currentChunk)
+		{
+			nodeIterator = m_LightRemovalQueue.erase(nodeIterator);
+		}
+		else
+		{
+			++nodeIterator;
+		}
+	}
+
+	size_t numberOfKeptNodes = 0U;
+	for (size_t nodeIndex = 0; nodeIndex < m_LightUpdateHeap.size(); ++nodeIndex)
+	{
+		if (m_LightUpdateHeap[nodeIndex].m_BlockInfo.GetChunk() != currentChunk)
+		{
+			m_LightUpdateHeap[numberOfKeptNodes] = m_LightUpdateHeap[nodeIndex];
+			++numberOfKeptNodes;
+		}
+	}
+
+	if (numberOfKeptNodes != m_LightUpdateHeap.size())
+	{
+		m_LightUpdateHeap.resize(numberOfKeptNodes);
+		std::make_heap(m_LightUpdateHeap.begin(), m_LightUpdateHeap.end(), std::greater<LightUpdateNode>());
+	}
+}
+
+
+
+void LightingEngine::ClearAllLightChanges()
+{
+	m_LightRemovalQueue.clear();
+	m_LightUpdateHeap.clear();
+}
+
+
+
+void LightingEngine::VerifyChunkGroupAgainstRelaxation(Chunk* centreChunk)
+{
+	std::vector<uint8_t> groupBlockTypes(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> groupSkyFlags(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> groupLightValues(NUMBER_OF_LIGHT_CHANNELS * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+
+	if (!CopyChunkGroupAroundChunk(centreChunk, groupBlockTypes.data(), groupSkyFlags.data(), groupLightValues.data()))
+	{
+		return;
+	}
+
+	std::deque<int> dirtyBlockIndices;
+
+	for (uint8_t lightChannel = 0; lightChannel < NUMBER_OF_LIGHT_CHANNELS; ++lightChannel)
+	{
+		uint8_t* channelLightValues = &groupLightValues[lightChannel * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP];
+
+		for (int groupIndex = 0; groupIndex < NUMBER_OF_BLOCKS_PER_CHUNK_GROUP; ++groupIndex)
+		{
+			channelLightValues[groupIndex] = 0U;
+			dirtyBlockIndices.push_back(groupIndex);
+		}
+
+		RelaxChunkGroupLight(groupBlockTypes.data(), groupSkyFlags.data(), lightChannel, channelLightValues, dirtyBlockIndices);
+
+		for (int localIndex = 0; localIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++localIndex)
+		{
+			int groupIndex = GetGroupIndexForLocalIndex(NUMBER_OF_CHUNKS_PER_GROUP / 2, localIndex);
+			ASSERT_OR_DIE(centreChunk->GetLightValue(localIndex, lightChannel) == channelLightValues[groupIndex], "Lighting Consistency Error.");
+		}
+	}
+}
+
+
+
+bool LightingEngine::CopyChunkGroupAroundChunk(Chunk* centreChunk, uint8_t* groupBlockTypes, uint8_t* groupSkyFlags, uint8_t* groupLightValues) const
+{
+	Chunk* groupChunks[NUMBER_OF_CHUNKS_PER_GROUP];
+	if (!GetChunkGroupAroundChunk(centreChunk, groupChunks))
+	{
+		return false;
+	}
+
+	for (int chunkIndex = 0; chunkIndex < NUMBER_OF_CHUNKS_PER_GROUP; ++chunkIndex)
+	{
+		Chunk* groupChunk = groupChunks[chunkIndex];
+
+		for (int localIndex = 0; localIndex < NUMBER_OF_BLOCKS_PER_CHUNK; ++localIndex)
+		{
+			int groupIndex = GetGroupIndexForLocalIndex(chunkIndex, localIndex);
+
+			groupBlockTypes[groupIndex] = groupChunk->GetBlockType(localIndex);
+			groupSkyFlags[groupIndex] = groupChunk->IsSky(localIndex) ? 1U : 0U;
+
+			for (uint8_t lightChannel = 0; lightChannel < NUMBER_OF_LIGHT_CHANNELS; ++lightChannel)
+			{
+				groupLightValues[(lightChannel * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP) + groupIndex] = static_cast<uint8_t>(groupChunk->GetLightValue(localIndex, lightChannel));
+			}
+		}
+	}
+
+	return true;
+}
+
+
+
+void LightingEngine::PushLightUpdate(BlockInfo currentBlockInfo, uint8_t lightChannel, bool needsRelighting)
+{
+	int updatePriority = GetPriorityForChunk(currentBlockInfo.GetChunk());
+
+	m_LightUpdateHeap.push_back(LightUpdateNode(currentBlockInfo, updatePriority, m_NextSequenceNumber, lightChannel, needsRelighting));
+	std::push_heap(m_LightUpdateHeap.begin(), m_LightUpdateHeap.end(), std::greater<LightUpdateNode>());
+
+	++m_NextSequenceNumber;
+}
+
+
+
+void LightingEngine::MarkBorderBlockForStitching(Chunk* currentChunk, const IntVector3& localCoordinates)
+{
+	int localIndex = currentChunk->GetLocalIndexForLocalCoordinates(localCoordinates);
+	uint8_t currentBlockType = currentChunk->GetBlockType(localIndex);
+
+	if (!BlockDefinition::IsOpaque(currentBlockType) || BlockDefinition::IsEmissive(currentBlockType))
+	{
+		MarkBlockForRelighting(BlockInfo(currentChunk, localIndex));
+	}
+}
+
+
+
+int LightingEngine::GetPriorityForChunk(Chunk* currentChunk) const
+{
+	if (m_NumberOfPriorityChunks == 0U)
+	{
+		return 0;
+	}
+
+	IntVector2 chunkCoordinates = currentChunk->GetChunkCoordinates();
+
+	int nearestSquaredDistance = 0;
+	for (size_t priorityIndex = 0; priorityIndex < m_NumberOfPriorityChunks; ++priorityIndex)
+	{
+		int displacementX = chunkCoordinates.X - m_PriorityChunkCoordinates[priorityIndex].X;
+		int displacementY = chunkCoordinates.Y - m_PriorityChunkCoordinates[priorityIndex].Y;
+		int squaredDistance = (displacementX * displacementX) + (displacementY * displacementY);
+
+		if (priorityIndex == 0U || squaredDistance < nearestSquaredDistance)
+		{
+			nearestSquaredDistance = squaredDistance;
+		}
+	}
+
+	return nearestSquaredDistance;
+}
+
+
+
+void LightingEngine::RelightBlock(BlockInfo currentBlockInfo, uint8_t lightChannel)
+{
+	int currentLightValue = currentBlockInfo.GetLightValue(lightChannel);
+	int idealLightValue = CalculateIdealLightForBlock(currentBlockInfo, lightChannel);
+
+	if (idealLightValue >= currentLightValue)
+	{
+		SetLightValueForBlock(currentBlockInfo, lightChannel, idealLightValue);
+		PushLightUpdate(currentBlockInfo, lightChannel, false);
+		return;
+	}
+
+	int baseLightValue = GetBaseLightValueForBlock(currentBlockInfo, lightChannel);
+	SetLightValueForBlock(currentBlockInfo, lightChannel, baseLightValue);
+	m_LightRemovalQueue.push_back(LightRemovalNode(currentBlockInfo, lightChannel, currentLightValue));
+
+	if (baseLightValue > 0)
+	{
+		PushLightUpdate(currentBlockInfo, lightChannel, false);
+	}
+}
+
+
+
+void LightingEngine::ProcessLightRemoval(const LightRemovalNode& removalNode)
+{
+	uint8_t lightChannel = removalNode.m_LightChannel;
+
+	BlockInfo neighbourBlockInfos[NUMBER_OF_BLOCK_NEIGHBOURS];
+	GetNeighboursOfBlock(removalNode.m_BlockInfo, neighbourBlockInfos);
+
+	for (int neighbourIndex = 0; neighbourIndex < NUMBER_OF_BLOCK_NEIGHBOURS; ++neighbourIndex)
+	{
+		BlockInfo& neighbourBlockInfo = neighbourBlockInfos[neighbourIndex];
+		if (neighbourBlockInfo.GetChunk() == nullptr)
+		{
+			continue;
+		}
+
+		int neighbourLightValue = neighbourBlockInfo.GetLightValue(lightChannel);
+		if (neighbourLightValue == 0)
+		{
+			continue;
+		}
+
+		if (BlockDefinition::IsOpaque(neighbourBlockInfo.GetBlockType()))
+		{
+			PushLightUpdate(neighbourBlockInfo, lightChannel, false);
+			continue;
+		}
+
+		if (neighbourLightValue >= removalNode.m_RemovedLightValue)
+		{
+			PushLightUpdate(neighbourBlockInfo, lightChannel, false);
+			continue;
+		}
+
+		int baseLightValue = GetBaseLightValueForBlock(neighbourBlockInfo, lightChannel);
+		SetLightValueForBlock(neighbourBlockInfo, lightChannel, baseLightValue);
+		m_LightRemovalQueue.push_back(LightRemovalNode(neighbourBlockInfo, lightChannel, neighbourLightValue));
+
+		if (baseLightValue > 0)
+		{
+			PushLightUpdate(neighbourBlockInfo, lightChannel, false);
+		}
+	}
+}
+
+
+
+void LightingEngine::ProcessLightPropagation(BlockInfo currentBlockInfo, uint8_t lightChannel)
+{
+	int propagatedLightValue = currentBlockInfo.GetLightValue(lightChannel) - 1;
+	if (propagatedLightValue <= 0)
+	{
+		return;
+	}
+
+	BlockInfo neighbourBlockInfos[NUMBER_OF_BLOCK_NEIGHBOURS];
+	GetNeighboursOfBlock(currentBlockInfo, neighbourBlockInfos);
+
+	for (int neighbourIndex = 0; neighbourIndex < NUMBER_OF_BLOCK_NEIGHBOURS; ++neighbourIndex)
+	{
+		BlockInfo& neighbourBlockInfo = neighbourBlockInfos[neighbourIndex];
+		if (neighbourBlockInfo.GetChunk() == nullptr)
+		{
+			continue;
+		}
+
+		if (BlockDefinition::IsOpaque(neighbourBlockInfo.GetBlockType()))
+		{
+			continue;
+		}
+
+		if (neighbourBlockInfo.GetLightValue(lightChannel) < propagatedLightValue)
+		{
+			SetLightValueForBlock(neighbourBlockInfo, lightChannel, propagatedLightValue);
+			PushLightUpdate(neighbourBlockInfo, lightChannel, false);
+		}
+	}
+}
+
+
+
+void LightingEngine::SetLightValueForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel, int lightValue)
+{
+	if (currentBlockInfo.GetLightValue(lightChannel) == lightValue)
+	{
+		return;
+	}
+
+	currentBlockInfo.SetLightValue(lightChannel, lightValue);
+	MarkFacesLitByBlock(currentBlockInfo);
+}
+
+
+
+void LightingEngine::MarkFacesLitByBlock(BlockInfo currentBlockInfo)
+{
+	uint8_t currentBlockType = currentBlockInfo.GetBlockType();
+	if (BlockDefinition::IsOpaque(currentBlockType))
+	{
+		return;
+	}
+
+	BlockInfo neighbourBlockInfos[NUMBER_OF_BLOCK_NEIGHBOURS];
+	GetNeighboursOfBlock(currentBlockInfo, neighbourBlockInfos);
+
+	for (int neighbourIndex = 0; neighbourIndex < NUMBER_OF_BLOCK_NEIGHBOURS; ++neighbourIndex)
+	{
+		BlockInfo& neighbourBlockInfo = neighbourBlockInfos[neighbourIndex];
+		Chunk* neighbourChunk = neighbourBlockInfo.GetChunk();
+		if (neighbourChunk == nullptr)
+		{
+			continue;
+		}
+
+		uint8_t neighbourBlockType = neighbourBlockInfo.GetBlockType();
+		if (!BlockDefinition::IsOpaque(neighbourBlockType) || !BlockDefinition::IsVisible(neighbourBlockType))
+		{
+			continue;
+		}
+
+		neighbourChunk->MarkSectionModified(neighbourChunk->GetSectionIndexForLocalIndex(neighbourBlockInfo.GetBlockIndex()));
+	}
+}
+
+
+
+int LightingEngine::GetBaseLightValueForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel)
+{
+	uint8_t currentBlockType = currentBlockInfo.GetBlockType();
+
+	if (lightChannel == BLOCK_LIGHT_CHANNEL)
+	{
+		return BlockDefinition::GetIlluminationValue(currentBlockType);
+	}
+
+	if (BlockDefinition::IsOpaque(currentBlockType))
+	{
+		return 0;
+	}
+
+	return currentBlockInfo.IsSky() ? SKY_LIGHT_VALUE : 0;
+}
+
+
+
+int LightingEngine::CalculateIdealLightForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel)
+{
+	int baseLightValue = GetBaseLightValueForBlock(currentBlockInfo, lightChannel);
+	if (BlockDefinition::IsOpaque(currentBlockInfo.GetBlockType()))
+	{
+		return baseLightValue;
+	}
+
+	BlockInfo neighbourBlockInfos[NUMBER_OF_BLOCK_NEIGHBOURS];
+	GetNeighboursOfBlock(currentBlockInfo, neighbourBlockInfos);
+
+	int idealLightValue = baseLightValue;
+	for (int neighbourIndex = 0; neighbourIndex < NUMBER_OF_BLOCK_NEIGHBOURS; ++neighbourIndex)
+	{
+		idealLightValue = GetMaximumOfTwoInts(idealLightValue, neighbourBlockInfos[neighbourIndex].GetLightValue(lightChannel) - 1);
+	}
+
+	return idealLightValue;
+}
+
+
+
+bool LightingEngine::GetChunkGroupAroundChunk(Chunk* centreChunk, Chunk** groupChunks) const
+{
+	for (int chunkIndex = 0; chunkIndex < NUMBER_OF_CHUNKS_PER_GROUP; ++chunkIndex)
+	{
+		groupChunks[chunkIndex] = nullptr;
+	}
+
+	Chunk* southernChunk = centreChunk->m_SouthernNeighbour;
+	Chunk* northernChunk = centreChunk->m_NorthernNeighbour;
+
+	groupChunks[1] = southernChunk;
+	groupChunks[4] = centreChunk;
+	groupChunks[7] = northernChunk;
+
+	for (int rowIndex = 0; rowIndex < CHUNK_GROUP_WIDTH; ++rowIndex)
+	{
+		Chunk* rowChunk = groupChunks[(rowIndex * CHUNK_GROUP_WIDTH) + 1];
+		if (rowChunk == nullptr)
+		{
+			return false;
+		}
+
+		groupChunks[rowIndex * CHUNK_GROUP_WIDTH] = rowChunk->m_WesternNeighbour;
+		groupChunks[(rowIndex * CHUNK_GROUP_WIDTH) + 2] = rowChunk->m_EasternNeighbour;
+	}
+
+	for (int chunkIndex = 0; chunkIndex < NUMBER_OF_CHUNKS_PER_GROUP; ++chunkIndex)
+	{
+		if (groupChunks[chunkIndex] == nullptr || !groupChunks[chunkIndex]->IsPopulated())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+void LightingEngine::RelaxChunkGroupLight(const uint8_t* groupBlockTypes, const uint8_t* groupSkyFlags, uint8_t lightChannel, uint8_t* groupLightValues, std::deque<int>& dirtyBlockIndices) const
+{
+	std::vector<uint8_t> blockIsDirty(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP, 0U);
+
+	for (int groupIndex : dirtyBlockIndices)
+	{
+		blockIsDirty[groupIndex] = 1U;
+	}
+
+	while (!dirtyBlockIndices.empty())
+	{
+		int groupIndex = dirtyBlockIndices.front();
+		dirtyBlockIndices.pop_front();
+		blockIsDirty[groupIndex] = 0U;
+
+		int neighbourIndices[NUMBER_OF_BLOCK_NEIGHBOURS];
+		int numberOfNeighbours = GetNeighboursInChunkGroup(groupIndex, neighbourIndices);
+
+		uint8_t currentBlockType = groupBlockTypes[groupIndex];
+		bool blockIsOpaque = BlockDefinition::IsOpaque(currentBlockType);
+
+		int idealLightValue = 0;
+		if (lightChannel == BLOCK_LIGHT_CHANNEL)
+		{
+			idealLightValue = BlockDefinition::GetIlluminationValue(currentBlockType);
+		}
+		else if (!blockIsOpaque && groupSkyFlags[groupIndex] != 0U)
+		{
+			idealLightValue = SKY_LIGHT_VALUE;
+		}
+
+		if (!blockIsOpaque)
+		{
+			for (int neighbourIndex = 0; neighbourIndex < numberOfNeighbours; ++neighbourIndex)
+			{
+				idealLightValue = GetMaximumOfTwoInts(idealLightValue, groupLightValues[neighbourIndices[neighbourIndex]] - 1);
+			}
+		}
+
+		if (idealLightValue == groupLightValues[groupIndex])
+		{
+			continue;
+		}
+
+		groupLightValues[groupIndex] = static_cast<uint8_t>(idealLightValue);
+
+		for (int neighbourIndex = 0; neighbourIndex < numberOfNeighbours; ++neighbourIndex)
+		{
+			int neighbourGroupIndex = neighbourIndices[neighbourIndex];
+			if (blockIsDirty[neighbourGroupIndex] == 0U && !BlockDefinition::IsOpaque(groupBlockTypes[neighbourGroupIndex]))
+			{
+				blockIsDirty[neighbourGroupIndex] = 1U;
+				dirtyBlockIndices.push_back(neighbourGroupIndex);
+			}
+		}
+	}
+}
+
+
+
+int LightingEngine::GetNeighboursInChunkGroup(int groupIndex, int* neighbourIndices) const
+{
+	int groupX = groupIndex % NUMBER_OF_GROUP_BLOCKS_X;
+	int groupY = (groupIndex / NUMBER_OF_GROUP_BLOCKS_X) % NUMBER_OF_GROUP_BLOCKS_Y;
+	int groupZ = groupIndex / NUMBER_OF_BLOCKS_PER_GROUP_LAYER;
+
+	int numberOfNeighbours = 0;
+
+	if (groupX < NUMBER_OF_GROUP_BLOCKS_X - 1)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex + 1;
+	}
+	if (groupX > 0)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex - 1;
+	}
+	if (groupY < NUMBER_OF_GROUP_BLOCKS_Y - 1)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex + NUMBER_OF_GROUP_BLOCKS_X;
+	}
+	if (groupY > 0)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex - NUMBER_OF_GROUP_BLOCKS_X;
+	}
+	if (groupZ < NUMBER_OF_BLOCKS_Z - 1)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex + NUMBER_OF_BLOCKS_PER_GROUP_LAYER;
+	}
+	if (groupZ > 0)
+	{
+		neighbourIndices[numberOfNeighbours++] = groupIndex - NUMBER_OF_BLOCKS_PER_GROUP_LAYER;
+	}
+
+	return numberOfNeighbours;
+}
+
+
+
+void LightingEngine::GetNeighboursOfBlock(BlockInfo currentBlockInfo, BlockInfo* neighbourBlockInfos)
+{
+	neighbourBlockInfos[0] = currentBlockInfo.GetEasternNeighbour();
+	neighbourBlockInfos[1] = currentBlockInfo.GetWesternNeighbour();
+	neighbourBlockInfos[2] = currentBlockInfo.GetNorthernNeighbour();
+	neighbourBlockInfos[3] = currentBlockInfo.GetSouthernNeighbour();
+	neighbourBlockInfos[4] = currentBlockInfo.GetAboveNeighbour();
+	neighbourBlockInfos[5] = currentBlockInfo.GetBelowNeighbour();
+
+	for (int neighbourIndex = 0; neighbourIndex < NUMBER_OF_BLOCK_NEIGHBOURS; ++neighbourIndex)
+	{
+		Chunk* neighbourChunk = neighbourBlockInfos[neighbourIndex].GetChunk();
+		if (neighbourChunk != nullptr && !neighbourChunk->IsPopulated())
+		{
+			neighbourBlockInfos[neighbourIndex] = BlockInfo();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Game/GameCommons.hpp"
+#include "Game/BlockInfo.hpp"
+
+
+
+const int NUMBER_OF_BLOCK_NEIGHBOURS = 6;
+const size_t LIGHTING_BUDGET_CHECK_INTERVAL = 64U;
+const size_t MAXIMUM_NUMBER_OF_PRIORITY_CHUNKS = 2U;
+const int CHUNK_GROUP_WIDTH = 3;
+const int NUMBER_OF_CHUNKS_PER_GROUP = CHUNK_GROUP_WIDTH * CHUNK_GROUP_WIDTH;
+const int NUMBER_OF_GROUP_BLOCKS_X = CHUNK_GROUP_WIDTH * NUMBER_OF_BLOCKS_X;
+const int NUMBER_OF_GROUP_BLOCKS_Y = CHUNK_GROUP_WIDTH * NUMBER_OF_BLOCKS_Y;
+const int NUMBER_OF_BLOCKS_PER_GROUP_LAYER = NUMBER_OF_GROUP_BLOCKS_X * NUMBER_OF_GROUP_BLOCKS_Y;
+const int NUMBER_OF_BLOCKS_PER_CHUNK_GROUP = NUMBER_OF_BLOCKS_PER_GROUP_LAYER * NUMBER_OF_BLOCKS_Z;
+
+
+
+struct LightRemovalNode
+{
+	BlockInfo m_BlockInfo;
+	uint8_t m_LightChannel;
+	int m_RemovedLightValue;
+
+	LightRemovalNode() :
+	m_LightChannel(BLOCK_LIGHT_CHANNEL),
+	m_RemovedLightValue(0)
+	{
+
+	}
+
+	LightRemovalNode(BlockInfo blockInfo, uint8_t lightChannel, int removedLightValue) :
+	m_BlockInfo(blockInfo),
+	m_LightChannel(lightChannel),
+	m_RemovedLightValue(removedLightValue)
+	{
+
+	}
+};
+
+
+
+struct LightUpdateNode
+{
+	BlockInfo m_BlockInfo;
+	int m_Priority;
+	uint64_t m_SequenceNumber;
+	uint8_t m_LightChannel;
+	bool m_NeedsRelighting;
+
+	LightUpdateNode() :
+	m_Priority(0),
+	m_SequenceNumber(0U),
+	m_LightChannel(BLOCK_LIGHT_CHANNEL),
+	m_NeedsRelighting(false)
+	{
+
+	}
+
+	LightUpdateNode(BlockInfo blockInfo, int priority, uint64_t sequenceNumber, uint8_t lightChannel, bool needsRelighting) :
+	m_BlockInfo(blockInfo),
+	m_Priority(priority),
+	m_SequenceNumber(sequenceNumber),
+	m_LightChannel(lightChannel),
+	m_NeedsRelighting(needsRelighting)
+	{
+
+	}
+
+	bool operator>(const LightUpdateNode& otherNode) const
+	{
+		if (m_Priority != otherNode.m_Priority)
+		{
+			return m_Priority > otherNode.m_Priority;
+		}
+
+		return m_SequenceNumber > otherNode.m_SequenceNumber;
+	}
+};
+
+
+
+class LightingEngine
+{
+public:
+	LightingEngine();
+
+	void MarkBlockForRelighting(BlockInfo currentBlockInfo);
+	void MarkColumnForRelighting(BlockInfo currentBlockInfo, int previousColumnHeight);
+	void StitchLightAcrossChunkBorders(Chunk* currentChunk);
+	void SetPriorityChunkCoordinates(const IntVector2* priorityChunkCoordinates, size_t numberOfPriorityChunks);
+	void PropagateLightChanges(double budgetInSeconds, size_t maximumNumberOfLightUpdates);
+	void DiscardLightChangesForChunk(Chunk* currentChunk);
+	void ClearAllLightChanges();
+	void VerifyChunkGroupAgainstRelaxation(Chunk* centreChunk);
+
+	bool CopyChunkGroupAroundChunk(Chunk* centreChunk, uint8_t* groupBlockTypes, uint8_t* groupSkyFlags, uint8_t* groupLightValues) const;
+	void RelaxChunkGroupLight(const uint8_t* groupBlockTypes, const uint8_t* groupSkyFlags, uint8_t lightChannel, uint8_t* groupLightValues, std::deque<int>& dirtyBlockIndices) const;
+	static int GetGroupIndexForLocalIndex(int chunkIndex, int localIndex);
+
+	size_t GetNumberOfPendingLightChanges() const;
+	size_t GetNumberOfProcessedLightChanges() const;
+
+private:
+	void PushLightUpdate(BlockInfo currentBlockInfo, uint8_t lightChannel, bool needsRelighting);
+	void MarkBorderBlockForStitching(Chunk* currentChunk, const IntVector3& localCoordinates);
+	int GetPriorityForChunk(Chunk* currentChunk) const;
+
+	void RelightBlock(BlockInfo currentBlockInfo, uint8_t lightChannel);
+	void ProcessLightRemoval(const LightRemovalNode& removalNode);
+	void ProcessLightPropagation(BlockInfo currentBlockInfo, uint8_t lightChannel);
+
+	void SetLightValueForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel, int lightValue);
+	void MarkFacesLitByBlock(BlockInfo currentBlockInfo);
+	int GetBaseLightValueForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel);
+	int CalculateIdealLightForBlock(BlockInfo currentBlockInfo, uint8_t lightChannel);
+	void GetNeighboursOfBlock(BlockInfo currentBlockInfo, BlockInfo* neighbourBlockInfos);
+
+	bool GetChunkGroupAroundChunk(Chunk* centreChunk, Chunk** groupChunks) const;
+	int GetNeighboursInChunkGroup(int groupIndex, int* neighbourIndices) const;
+
+private:
+	std::deque<LightRemovalNode> m_LightRemovalQueue;
+	std::vector<LightUpdateNode> m_LightUpdateHeap;
+	uint64_t m_NextSequenceNumber;
+
+	IntVector2 m_PriorityChunkCoordinates[MAXIMUM_NUMBER_OF_PRIORITY_CHUNKS];
+	size_t m_NumberOfPriorityChunks;
+	size_t m_NumberOfProcessedLightChanges;
+};
+
+
+
+inline size_t LightingEngine::GetNumberOfPendingLightChanges() const
+{
+	return m_LightRemovalQueue.size() + m_LightUpdateHeap.size();
+}
+
+
+
+inline size_t LightingEngine::GetNumberOfProcessedLightChanges() const
+{
+	return m_NumberOfProcessedLightChanges;
+}
+
+
+
+inline int LightingEngine::GetGroupIndexForLocalIndex(int chunkIndex, int localIndex)
+{
+	int groupX = ((chunkIndex % CHUNK_GROUP_WIDTH) * NUMBER_OF_BLOCKS_X) + (localIndex & BLOCKS_X_MASK);
+	int groupY = ((chunkIndex / CHUNK_GROUP_WIDTH) * NUMBER_OF_BLOCKS_Y) + ((localIndex >> BLOCK_BITS_X) & BLOCKS_Y_MASK);
+
+	return ((localIndex >> BLOCK_BITS_PER_LAYER) * NUMBER_OF_BLOCKS_PER_GROUP_LAYER) + (groupY * NUMBER_OF_GROUP_BLOCKS_X) + groupX;
+}
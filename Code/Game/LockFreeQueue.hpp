@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+
+
+
+template <typename T, size_t CAPACITY>
+class LockFreeQueue
+{
+	static_assert((CAPACITY & (CAPACITY - 1U)) == 0U, "Queue capacity must be a power of two.");
+
+public:
+	LockFreeQueue();
+
+	bool Push(const T& currentItem);
+	bool Pop(T& currentItem);
+
+	size_t GetSize() const;
+
+private:
+	struct QueueCell
+	{
+		std::atomic<size_t> m_Sequence;
+		T m_Item;
+	};
+
+private:
+	QueueCell m_Cells[CAPACITY];
+
+	alignas(64) std::atomic<size_t> m_PushPosition;
+	alignas(64) std::atomic<size_t> m_PopPosition;
+};
+
+
+
+template <typename T, size_t CAPACITY>
+LockFreeQueue<T, CAPACITY>::LockFreeQueue() :
+m_PushPosition(0U),
+m_PopPosition(0U)
+{
+	for (size_t cellIndex = 0; cellIndex < CAPACITY; ++cellIndex)
+	{
+		m_Cells[cellIndex].m_Sequence.store(cellIndex, std::memory_order_relaxed);
+	}
+}
+
+
+
+template <typename T, size_t CAPACITY>
+bool LockFreeQueue<T, CAPACITY>::Push(const T& currentItem)
+{
+	size_t pushPosition = m_PushPosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		QueueCell& currentCell = m_Cells[pushPosition & (CAPACITY - 1U)];
+		size_t cellSequence = currentCell.m_Sequence.load(std::memory_order_acquire);
+		intptr_t sequenceDifference = static_cast<intptr_t>(cellSequence) - static_cast<intptr_t>(pushPosition);
+
+		if (sequenceDifference == 0)
+		{
+			if (m_PushPosition.compare_exchange_weak(pushPosition, pushPosition + 1U, std::memory_order_relaxed))
+			{
+				currentCell.m_Item = currentItem;
+				currentCell.m_Sequence.store(pushPosition + 1U, std::memory_order_release);
+
+				return true;
+			}
+		}
+		else if (sequenceDifference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			pushPosition = m_PushPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+
+
+template <typename T, size_t CAPACITY>
+bool LockFreeQueue<T, CAPACITY>::Pop(T& currentItem)
+{
+	size_t popPosition = m_PopPosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		QueueCell& currentCell = m_Cells[popPosition & (CAPACITY - 1U)];
+		size_t cellSequence = currentCell.m_Sequence.load(std::memory_order_acquire);
+		intptr_t sequenceDifference = static_cast<intptr_t>(cellSequence) - static_cast<intptr_t>(popPosition + 1U);
+
+		if (sequenceDifference == 0)
+		{
+			if (m_PopPosition.compare_exchange_weak(popPosition, popPosition + 1U, std::memory_order_relaxed))
+			{
+				currentItem = currentCell.m_Item;
+				currentCell.m_Sequence.store(popPosition + CAPACITY, std::memory_order_release);
+
+				return true;
+			}
+		}
+		else if (sequenceDifference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			popPosition = m_PopPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+
+
+template <typename T, size_t CAPACITY>
+size_t LockFreeQueue<T, CAPACITY>::GetSize() const
+{
+	size_t pushPosition = m_PushPosition.load(std::memory_order_relaxed);
+	size_t popPosition = m_PopPosition.load(std::memory_order_relaxed);
+
+	return (pushPosition > popPosition) ? (pushPosition - popPosition) : 0U;
+}
@@ -241,6 +241,10 @@ void TheGame::Update(float deltaTimeInSeconds)
 
 		ToggleDebugMode();
 		ToggleScreenshotMode();
+		ToggleGreedyMeshing();
+		TogglePalettedBlockStorage();
+		RunFaceVisibilityBenchmark();
+		RunLightingComparison();
 
 		(!g_TwoPlayerMode) ? OnePlayerUpdateCall(deltaTimeInSeconds) : TwoPlayerUpdateCall(deltaTimeInSeconds);
 
@@ -1055,6 +1059,46 @@ void TheGame::ToggleScreenshotMode()
 
 
 
+void TheGame::ToggleGreedyMeshing()
+{
+	if (InputSystem::SingletonInstance()->KeyWasJustPressed('G'))
+	{
+		g_GreedyMeshing = !g_GreedyMeshing;
+	}
+}
+
+
+
+void TheGame::TogglePalettedBlockStorage()
+{
+	if (InputSystem::SingletonInstance()->KeyWasJustPressed('B'))
+	{
+		g_PalettedBlockStorage = !g_PalettedBlockStorage;
+	}
+}
+
+
+
+void TheGame::RunFaceVisibilityBenchmark()
+{
+	if (g_DebugMode && InputSystem::SingletonInstance()->KeyWasJustPressed('V'))
+	{
+		m_World->BenchmarkFaceVisibility();
+	}
+}
+
+
+
+void TheGame::RunLightingComparison()
+{
+	if (g_DebugMode && InputSystem::SingletonInstance()->KeyWasJustPressed('L'))
+	{
+		m_World->CompareLightingAgainstRelaxation();
+	}
+}
+
+
+
 void TheGame::SetUpDrawingIn3D(const Camera3D* playerCamera) const
 {
 	AdvancedRenderer::SingletonInstance()->EnableDepthTesting(true);
@@ -1441,6 +1485,61 @@ void TheGame::DisplayCameraStatsIn2D(const Camera3D& playerCamera, uint8_t playe
 	statMinimums.Y -= 0.3f;
 	sprintf_s(stringBuffer, "Physics Mode: %s", physicsMode);
 	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	const ChunkQueueStatistics& loadQueueStatistics = m_World->GetLoadQueueStatistics();
+	const ChunkQueueStatistics& populatedQueueStatistics = m_World->GetPopulatedQueueStatistics();
+	const ChunkQueueStatistics& saveQueueStatistics = m_World->GetSaveQueueStatistics();
+	const ChunkQueueStatistics& meshQueueStatistics = m_World->GetMeshQueueStatistics();
+	const ChunkWorkerPool& chunkWorkerPool = m_World->GetChunkWorkerPool();
+	const ChunkProxyPool& chunkProxyPool = m_World->GetChunkProxyPool();
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Load Queue = %zu (Peak %zu), Latency = %0.2f ms (Peak %0.2f ms)", loadQueueStatistics.GetQueueDepth(), loadQueueStatistics.GetMaximumQueueDepth(), loadQueueStatistics.GetAverageLatencyInMilliseconds(), loadQueueStatistics.GetMaximumLatencyInMilliseconds());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Populated Queue = %zu (Peak %zu), Cancelled Loads = %zu", populatedQueueStatistics.GetQueueDepth(), populatedQueueStatistics.GetMaximumQueueDepth(), loadQueueStatistics.GetNumberOfCancelledRequests());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Save Queue = %zu (Peak %zu), Latency = %0.2f ms (Peak %0.2f ms)", saveQueueStatistics.GetQueueDepth(), saveQueueStatistics.GetMaximumQueueDepth(), saveQueueStatistics.GetAverageLatencyInMilliseconds(), saveQueueStatistics.GetMaximumLatencyInMilliseconds());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Mesh Queue = %zu (Peak %zu), Latency = %0.2f ms (Peak %0.2f ms)", meshQueueStatistics.GetQueueDepth(), meshQueueStatistics.GetMaximumQueueDepth(), meshQueueStatistics.GetAverageLatencyInMilliseconds(), meshQueueStatistics.GetMaximumLatencyInMilliseconds());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Pending Rebuilds = %zu, Stale Meshes = %zu, Scratch Allocations = %zu (Grew After Warm-Up %zu)", m_World->GetNumberOfPendingMeshRebuilds(), meshQueueStatistics.GetNumberOfCancelledRequests(), ChunkMeshScratchArena::GetNumberOfAllocations(), m_World->GetNumberOfScratchArenaGrowths());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Lighting Backlog = %zu, Light Updates This Frame = %zu", m_World->GetNumberOfPendingLightUpdates(), m_World->GetNumberOfProcessedLightUpdates());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Meshing: %s, Chunk Vertices = %zu, Indices = %zu, Uploaded = %0.2f MB", (g_GreedyMeshing) ? "Greedy" : "Per Face", m_World->GetNumberOfChunkMeshVertices(), m_World->GetNumberOfChunkMeshIndices(), static_cast<double>(m_World->GetNumberOfUploadedMeshBytes()) / (1024.0 * 1024.0));
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Block Storage: %s, Block Types = %0.2f MB", (g_PalettedBlockStorage) ? "Paletted" : "Flat", static_cast<double>(m_World->GetNumberOfBlockTypeBytes()) / (1024.0 * 1024.0));
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Chunk Workers = %zu, Queued Jobs = %zu", chunkWorkerPool.GetNumberOfWorkers(), chunkWorkerPool.GetNumberOfQueuedJobs());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Chunk Proxies = %zu Free of %zu, Pool = %0.2f MB", chunkProxyPool.GetNumberOfFreeChunkProxies(), CHUNK_PROXY_POOL_SIZE, static_cast<double>(ChunkProxyPool::GetPoolSizeInBytes()) / (1024.0 * 1024.0));
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Face Visibility (V): BlockInfo Per Block = %0.3f ms, Row Masks = %0.3f ms per chunk over %zu chunks", m_World->GetPerBlockVisibilityMilliseconds(), m_World->GetRowMaskVisibilityMilliseconds(), m_World->GetNumberOfBenchmarkedChunks());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
+
+	statMinimums.Y -= 0.3f;
+	sprintf_s(stringBuffer, "Lighting Comparison (L): %zu Mismatched Light Values over %zu Edits", m_World->GetNumberOfLightingMismatches(), m_World->GetNumberOfComparedLightingEdits());
+	AdvancedRenderer::SingletonInstance()->Draw2DMonospacedText(statMinimums, stringBuffer, 0.2f, 1.0f, m_HUDFont);
 }
 
 
@@ -110,6 +110,10 @@ private:
 
 	void ToggleDebugMode();
 	void ToggleScreenshotMode();
+	void ToggleGreedyMeshing();
+	void TogglePalettedBlockStorage();
+	void RunFaceVisibilityBenchmark();
+	void RunLightingComparison();
 
 	void SetUpDrawingIn3D(const Camera3D* playerCamera) const;
 	void SetUpDrawingIn2D() const;
@@ -1,30 +1,30 @@
 #include "Game/World.hpp"
 #include "Game/TheGame.hpp"
+#include "Game/ChunkQuadIndexBuffer.hpp"
 
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #include <thread>
+#include <math.h>
+#include <algorithm>
 
 
 
-CRITICAL_SECTION g_ChunkLoadingCriticalSection;
-CRITICAL_SECTION g_ChunkPopulatingCriticalSection;
-CRITICAL_SECTION g_ChunkSavingCriticalSection;
+ChunkQueue g_LoadRequestQueue;
+ChunkQueue g_PopulatedChunkQueue;
+ChunkQueue g_SaveRequestQueue;
+ChunkQueue g_MeshRequestQueue;
+ChunkQueue g_MeshedChunkQueue;
 
-ChunkProxy* g_SharedLoadedChunkProxies = nullptr;
-ChunkProxy* g_LocalLoadedChunkProxies = nullptr;
-size_t g_NumberOfActivatedChunks = 0U;
+ChunkQueueStatistics g_LoadQueueStatistics;
+ChunkQueueStatistics g_PopulatedQueueStatistics;
+ChunkQueueStatistics g_SaveQueueStatistics;
+ChunkQueueStatistics g_MeshQueueStatistics;
 
-ChunkProxy* g_SharedPopulatedChunkProxies = nullptr;
-ChunkProxy* g_LocalPopulatedChunkProxies = nullptr;
-size_t g_NumberOfPopulatedChunks = 0U;
+ChunkProxyPool g_ChunkProxyPool;
+ChunkMeshSnapshotPool g_ChunkMeshSnapshotPool;
+ChunkWorkerPool g_ChunkWorkerPool;
 
-ChunkProxy* g_SharedSavedChunkProxies = nullptr;
-ChunkProxy* g_LocalSavedChunkProxies = nullptr;
-size_t g_NumberOfSavedChunks = 0U;
-
-uint8_t g_RLEBuffer[4096U];
-bool g_WorldIsActive = false;
 
 const size_t NUMBER_OF_SKYBOX_VERTICES = 24U;
 const size_t NUMBER_OF_SKYBOX_INDICES = 36U;
@@ -37,9 +37,27 @@ m_PlayerTwoRaycastResult(RaycastResult3D()),
 m_PlayerOne(nullptr),
 m_PlayerTwo(nullptr),
 m_NumberOfActiveChunks(0U),
+m_LatestMeshRevision(0U),
+m_NumberOfPendingMeshRebuilds(0U),
+m_GreedyMeshingIsEnabled(g_GreedyMeshing),
+m_PalettedBlockStorageIsEnabled(g_PalettedBlockStorage),
+m_NumberOfChunkMeshVertices(0U),
+m_NumberOfChunkMeshIndices(0U),
+m_NumberOfUploadedMeshBytes(0U),
+m_NumberOfWarmUpRebuilds(0U),
+m_PreviousScratchAllocations(0U),
+m_NumberOfScratchArenaGrowths(0U),
+m_NumberOfBenchmarkedChunks(0U),
+m_PerBlockVisibilityMilliseconds(0.0),
+m_RowMaskVisibilityMilliseconds(0.0),
+m_NumberOfComparedLightingEdits(0U),
+m_NumberOfLightingMismatches(0U),
+m_LatestEditedChunkCoordinates(IntVector2::ZERO),
+m_LightingNeedsVerification(false),
 m_NumberOfAliveEnemies(0U),
 m_PlayerAngleToSun(90.0f),
 m_SkyRotation(0.0f),
+m_SkyLightIntensity(1.0f),
 m_WaterRipple(0.0f)
 {
 	CreateAndLoadPlayer(m_PlayerOne, g_TheGame->m_PlayerOneCamera, "PlayerOne.dat");
@@ -48,35 +66,35 @@ m_WaterRipple(0.0f)
 		CreateAndLoadPlayer(m_PlayerTwo, g_TheGame->m_PlayerTwoCamera, "PlayerTwo.dat");
 	}
 
-	g_SharedLoadedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
-	g_LocalLoadedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
-
-	g_SharedPopulatedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
-	g_LocalPopulatedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
-	
-	g_SharedSavedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
-	g_LocalSavedChunkProxies = new ChunkProxy[MAXIMUM_NUMBER_OF_CHUNKS];
+	g_ChunkProxyPool.InitializeChunkProxyPool();
+	g_ChunkMeshSnapshotPool.InitializeChunkMeshSnapshotPool();
+	GenerateChunkActivationOffsets(ACTIVE_CHUNK_RADIUS);
+	m_ChunkRebuildQueue.reserve(MAXIMUM_NUMBER_OF_CHUNKS);
+	m_DeferredMeshedRequests.reserve(CHUNK_MESH_SNAPSHOT_POOL_SIZE);
 
-	size_t proxyArraySize = MAXIMUM_NUMBER_OF_CHUNKS * sizeof(ChunkProxy);
-	memset(g_SharedLoadedChunkProxies, 0, proxyArraySize);
-	memset(g_LocalLoadedChunkProxies, 0, proxyArraySize);
+	m_PreviousStreamingPositions[PLAYER_ONE] = m_PlayerOne->m_Position;
+	m_PreviousStreamingPositions[PLAYER_TWO] = (g_TwoPlayerMode) ? m_PlayerTwo->m_Position : Vector3::ZERO;
+	m_StreamingVelocities[PLAYER_ONE] = Vector3::ZERO;
+	m_StreamingVelocities[PLAYER_TWO] = Vector3::ZERO;
 
-	memset(g_SharedPopulatedChunkProxies, 0, proxyArraySize);
-	memset(g_LocalPopulatedChunkProxies, 0, proxyArraySize);
-	
-	memset(g_SharedSavedChunkProxies, 0, proxyArraySize);
-	memset(g_LocalSavedChunkProxies, 0, proxyArraySize);
+	size_t numberOfChunkWorkers = ChunkWorkerPool::GetIdealNumberOfWorkers();
+	g_ChunkWorkerPool.InitializeWorkerPool(numberOfChunkWorkers);
 
-	g_WorldIsActive = true;
+	for (size_t workerIndex = 0; workerIndex < numberOfChunkWorkers; ++workerIndex)
+	{
+		Thread* chunkManagementThread = Thread::CreateNewThread(ProcessChunkManagement, reinterpret_cast<void*>(workerIndex));
+		chunkManagementThread->DetachThread();
+		m_ChunkManagementThreads.push_back(chunkManagementThread);
+	}
 
-	InitializeCriticalSection(&g_ChunkLoadingCriticalSection);
-	InitializeCriticalSection(&g_ChunkSavingCriticalSection);
-	InitializeCriticalSection(&g_ChunkPopulatingCriticalSection);
+	m_ChunkPool.InitializeObjectPool(MAXIMUM_NUMBER_OF_CHUNKS);
 
-	m_ChunkManagementThread = Thread::CreateNewThread(ProcessChunkManagement, nullptr);
-	m_ChunkManagementThread->DetachThread();
+	m_FreeChunkSlots.reserve(MAXIMUM_NUMBER_OF_CHUNKS);
+	for (size_t chunkSlotIndex = MAXIMUM_NUMBER_OF_CHUNKS; chunkSlotIndex > 0U; --chunkSlotIndex)
+	{
+		m_FreeChunkSlots.push_back(chunkSlotIndex - 1U);
+	}
 
-	m_ChunkPool.InitializeObjectPool(MAXIMUM_NUMBER_OF_CHUNKS);
 	m_EnemyPool.InitializeObjectPool(MAXIMUM_NUMBER_OF_ENEMIES);
 
 	SamplerData textureSamplerData = SamplerData(REPEAT_WRAP, REPEAT_WRAP, NEAREST_FILTER, NEAREST_FILTER);
@@ -90,6 +108,7 @@ m_WaterRipple(0.0f)
 	m_ChunkMaterial->SetSpecularTexture(m_SpecularSpriteSheet->GetSpriteSheet());
 
 	BlockDefinition::InitializeBlockDefinitions(*m_DiffuseSpriteSheet);
+	ChunkQuadIndexBuffer::InitializeChunkQuadIndexBuffer();
 
 	m_SkyboxSpriteSheet = new SpriteSheet("Data/Images/SkyboxTexture.png", 4, 3, textureSamplerData);
 	m_SkyboxMaterial = new Material("Data/Shaders/SkyboxShader.vert", "Data/Shaders/SkyboxShader.frag");
@@ -114,8 +133,17 @@ m_WaterRipple(0.0f)
 
 World::~World()
 {
-	g_WorldIsActive = false;
-	
+	g_ChunkWorkerPool.RequestShutdown();
+	g_ChunkWorkerPool.WaitForAllWorkersToStop();
+	FinishRemainingChunkJobs();
+
+	for (Thread* chunkManagementThread : m_ChunkManagementThreads)
+	{
+		Thread::DestroyThread(chunkManagementThread);
+	}
+
+	m_ChunkManagementThreads.clear();
+
 	if (m_NumberOfActiveChunks > 0U)
 	{
 		for (size_t chunkIndex = 0; chunkIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkIndex)
@@ -141,14 +169,45 @@ World::~World()
 
 			m_ChunkPool.DeallocateObjectToPool(currentChunk);
 			m_AllChunks[chunkIndex] = nullptr;
+			m_FreeChunkSlots.push_back(chunkIndex);
 
 			--m_NumberOfActiveChunks;
 		}
+
+		m_ActiveChunkMap.RemoveAllChunks();
+		m_LightingEngine.ClearAllLightChanges();
+	}
+
+	ChunkRequest discardedRequest;
+	while (g_LoadRequestQueue.Pop(discardedRequest))
+	{
+		g_ChunkProxyPool.DeallocateChunkProxy(discardedRequest.m_ChunkProxy);
+	}
+
+	while (g_PopulatedChunkQueue.Pop(discardedRequest))
+	{
+		g_ChunkProxyPool.DeallocateChunkProxy(discardedRequest.m_ChunkProxy);
+	}
+
+	while (g_MeshRequestQueue.Pop(discardedRequest))
+	{
+		g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(discardedRequest.m_MeshSnapshot);
+	}
+
+	while (g_MeshedChunkQueue.Pop(discardedRequest))
+	{
+		g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(discardedRequest.m_MeshSnapshot);
 	}
 
-	DeleteCriticalSection(&g_ChunkLoadingCriticalSection);
-	DeleteCriticalSection(&g_ChunkSavingCriticalSection);
-	DeleteCriticalSection(&g_ChunkPopulatingCriticalSection);
+	for (const ChunkRequest& deferredRequest : m_DeferredMeshedRequests)
+	{
+		g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(deferredRequest.m_MeshSnapshot);
+	}
+	m_DeferredMeshedRequests.clear();
+
+	g_ChunkWorkerPool.UninitializeWorkerPool();
+	g_ChunkMeshSnapshotPool.UninitializeChunkMeshSnapshotPool();
+	g_ChunkProxyPool.UninitializeChunkProxyPool();
 
 	m_ChunkPool.UninitializeObjectPool();
 
@@ -157,15 +216,6 @@ World::~World()
 
 	delete m_WaterMaterial;
 
-	delete g_SharedLoadedChunkProxies;
-	delete g_LocalLoadedChunkProxies;
-
-	delete g_SharedPopulatedChunkProxies;
-	delete g_LocalPopulatedChunkProxies;
-	
-	delete g_SharedSavedChunkProxies;
-	delete g_LocalSavedChunkProxies;
-
 	delete m_SkyboxMaterial;
 	delete m_SkyboxMesh;
 	delete m_SkyboxSpriteSheet;
@@ -225,7 +275,7 @@ RaycastResult3D World::GetAWRaycast(const Vector3& startPosition, const Vector3&
 
 	if (currentBlockInfo.GetChunk() != nullptr)
 	{
-		if (currentBlockInfo.GetBlock()->IsSolid())
+		if (currentBlockInfo.GetBlock().IsSolid())
 		{
 			raycastResult.m_impactedSolidBlock = true;
 			raycastResult.m_impactedPosition = startPosition;
@@ -294,7 +344,7 @@ RaycastResult3D World::GetAWRaycast(const Vector3& startPosition, const Vector3&
 
 			if (currentBlockInfo.GetChunk() != nullptr)
 			{
-				if (currentBlockInfo.GetBlock()->IsSolid())
+				if (currentBlockInfo.GetBlock().IsSolid())
 				{
 					raycastResult.m_impactedSolidBlock = true;
 					raycastResult.m_surfaceNormal = (blockStepX > 0) ? Vector3(-1.0f, 0.0f, 0.0f) : Vector3(1.0f, 0.0f, 0.0f);
@@ -315,7 +365,7 @@ RaycastResult3D World::GetAWRaycast(const Vector3& startPosition, const Vector3&
 
 			if (currentBlockInfo.GetChunk() != nullptr)
 			{
-				if (currentBlockInfo.GetBlock()->IsSolid())
+				if (currentBlockInfo.GetBlock().IsSolid())
 				{
 					raycastResult.m_impactedSolidBlock = true;
 					raycastResult.m_surfaceNormal = (blockStepY > 0) ? Vector3(0.0f, -1.0f, 0.0f) : Vector3(0.0f, 1.0f, 0.0f);
@@ -336,7 +386,7 @@ RaycastResult3D World::GetAWRaycast(const Vector3& startPosition, const Vector3&
 
 			if (currentBlockInfo.GetChunk() != nullptr)
 			{
-				if (currentBlockInfo.GetBlock()->IsSolid())
+				if (currentBlockInfo.GetBlock().IsSolid())
 				{
 					raycastResult.m_impactedSolidBlock = true;
 					raycastResult.m_surfaceNormal = (blockStepZ > 0) ? Vector3(0.0f, 0.0f, -1.0f) : Vector3(0.0f, 0.0f, 1.0f);
@@ -395,18 +445,7 @@ void World::Update(float deltaTimeInSeconds)
 
 	UpdateLighting();
 
-	for (Chunk* currentChunk : m_AllChunks)
-	{
-		if (currentChunk != nullptr)
-		{
-			if (currentChunk->IsModified())
-			{
-				currentChunk->RebuildChunkMesh();
-				currentChunk->RebuildWaterMesh();
-				currentChunk->SetModified(false);
-			}
-		}
-	}
+	UpdateChunkMeshes();
 
 	UpdatePlayerLights();
 	UpdatePlayerAngleToSun(deltaTimeInSeconds);
@@ -436,6 +475,9 @@ void World::RenderWorldFromCamera(const Camera3D* playerCamera, uint8_t currentP
 			}
 		}
 	}
+
+	Matrix4 modelMatrix = AdvancedRenderer::SingletonInstance()->GetModelMatrix(Vector3::ONE, EulerAngles::ZERO, Vector3::ZERO);
+	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(modelMatrix);
 }
 
 
@@ -464,6 +506,9 @@ void World::RenderWaterFromCamera(const Camera3D* playerCamera, Texture** colorT
 		}
 	}
 
+	Matrix4 modelMatrix = AdvancedRenderer::SingletonInstance()->GetModelMatrix(Vector3::ONE, EulerAngles::ZERO, Vector3::ZERO);
+	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(modelMatrix);
+
 	AdvancedRenderer::SingletonInstance()->EnableBackFaceCulling(true);
 }
 
@@ -533,6 +578,370 @@ void World::RenderAllEntities() const
 
 
 
+const ChunkQueueStatistics& World::GetLoadQueueStatistics() const
+{
+	return g_LoadQueueStatistics;
+}
+
+
+
+const ChunkQueueStatistics& World::GetPopulatedQueueStatistics() const
+{
+	return g_PopulatedQueueStatistics;
+}
+
+
+
+const ChunkQueueStatistics& World::GetSaveQueueStatistics() const
+{
+	return g_SaveQueueStatistics;
+}
+
+
+
+const ChunkQueueStatistics& World::GetMeshQueueStatistics() const
+{
+	return g_MeshQueueStatistics;
+}
+
+
+
+const ChunkWorkerPool& World::GetChunkWorkerPool() const
+{
+	return g_ChunkWorkerPool;
+}
+
+
+
+const ChunkProxyPool& World::GetChunkProxyPool() const
+{
+	return g_ChunkProxyPool;
+}
+
+
+
+size_t World::GetNumberOfPendingMeshRebuilds() const
+{
+	return m_NumberOfPendingMeshRebuilds;
+}
+
+
+
+size_t World::GetNumberOfPendingLightUpdates() const
+{
+	return m_LightingEngine.GetNumberOfPendingLightChanges();
+}
+
+
+
+size_t World::GetNumberOfProcessedLightUpdates() const
+{
+	return m_LightingEngine.GetNumberOfProcessedLightChanges();
+}
+
+
+
+size_t World::GetNumberOfChunkMeshVertices() const
+{
+	return m_NumberOfChunkMeshVertices;
+}
+
+
+
+size_t World::GetNumberOfChunkMeshIndices() const
+{
+	return m_NumberOfChunkMeshIndices;
+}
+
+
+
+uint64_t World::GetNumberOfUploadedMeshBytes() const
+{
+	return m_NumberOfUploadedMeshBytes;
+}
+
+
+
+size_t World::GetNumberOfScratchArenaGrowths() const
+{
+	return m_NumberOfScratchArenaGrowths;
+}
+
+
+
+size_t World::GetNumberOfBlockTypeBytes() const
+{
+	size_t numberOfBlockTypeBytes = 0U;
+
+	for (const Chunk* currentChunk : m_AllChunks)
+	{
+		if (currentChunk != nullptr)
+		{
+			numberOfBlockTypeBytes += currentChunk->GetNumberOfBlockTypeBytes();
+		}
+	}
+
+	return numberOfBlockTypeBytes;
+}
+
+
+
+size_t World::GetNumberOfBenchmarkedChunks() const
+{
+	return m_NumberOfBenchmarkedChunks;
+}
+
+
+
+double World::GetPerBlockVisibilityMilliseconds() const
+{
+	return m_PerBlockVisibilityMilliseconds;
+}
+
+
+
+double World::GetRowMaskVisibilityMilliseconds() const
+{
+	return m_RowMaskVisibilityMilliseconds;
+}
+
+
+
+size_t World::GetNumberOfComparedLightingEdits() const
+{
+	return m_NumberOfComparedLightingEdits;
+}
+
+
+
+size_t World::GetNumberOfLightingMismatches() const
+{
+	return m_NumberOfLightingMismatches;
+}
+
+
+
+void World::BenchmarkFaceVisibility()
+{
+	ChunkMeshSnapshot* benchmarkSnapshot = new ChunkMeshSnapshot();
+	ChunkMeshScratchArena* benchmarkScratchArena = new ChunkMeshScratchArena();
+	std::vector<uint16_t> rowMaskFaceRows(NUMBER_OF_BLOCK_FACES * NUMBER_OF_BLOCK_ROWS);
+
+	double perBlockSeconds = 0.0;
+	double rowMaskSeconds = 0.0;
+	size_t numberOfBenchmarkedChunks = 0U;
+
+	for (Chunk* currentChunk : m_AllChunks)
+	{
+		if (currentChunk == nullptr || !currentChunk->IsPopulated())
+		{
+			continue;
+		}
+
+		currentChunk->PopulateMeshSnapshotFromChunk(*benchmarkSnapshot);
+
+		double rowMaskStartTime = GetCurrentTimeInSeconds();
+		benchmarkSnapshot->BuildExposedFacesFromRowMasks(*benchmarkScratchArena);
+		rowMaskSeconds += GetCurrentTimeInSeconds() - rowMaskStartTime;
+
+		for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+		{
+			memcpy(&rowMaskFaceRows[blockFace * NUMBER_OF_BLOCK_ROWS], benchmarkScratchArena->GetExposedFaceRows(blockFace), NUMBER_OF_BLOCK_ROWS * sizeof(uint16_t));
+		}
+
+		double perBlockStartTime = GetCurrentTimeInSeconds();
+		currentChunk->BuildExposedFacesFromBlockInfo(*benchmarkScratchArena);
+		perBlockSeconds += GetCurrentTimeInSeconds() - perBlockStartTime;
+
+		for (uint8_t blockFace = 0; blockFace < NUMBER_OF_BLOCK_FACES; ++blockFace)
+		{
+			bool facesMatch = (memcmp(&rowMaskFaceRows[blockFace * NUMBER_OF_BLOCK_ROWS], benchmarkScratchArena->GetExposedFaceRows(blockFace), NUMBER_OF_BLOCK_ROWS * sizeof(uint16_t)) == 0);
+			ASSERT_OR_DIE(facesMatch, "Face Visibility Error.");
+		}
+
+		++numberOfBenchmarkedChunks;
+	}
+
+	delete benchmarkScratchArena;
+	delete benchmarkSnapshot;
+
+	if (numberOfBenchmarkedChunks == 0U)
+	{
+		return;
+	}
+
+	m_NumberOfBenchmarkedChunks = numberOfBenchmarkedChunks;
+	m_PerBlockVisibilityMilliseconds = (perBlockSeconds * 1000.0) / static_cast<double>(numberOfBenchmarkedChunks);
+	m_RowMaskVisibilityMilliseconds = (rowMaskSeconds * 1000.0) / static_cast<double>(numberOfBenchmarkedChunks);
+}
+
+
+
+void World::CompareLightingAgainstRelaxation()
+{
+	IntVector2 centreChunkCoordinates = GetChunkCoordinatesForPlayerPosition(PLAYER_ONE);
+
+	std::vector<uint8_t> rleBuffer(MAXIMUM_RLE_BUFFER_SIZE);
+	std::vector<uint16_t> lightPropagationQueue;
+	ChunkProxy* comparisonProxy = new ChunkProxy();
+	Chunk* comparisonChunks[NUMBER_OF_CHUNKS_PER_GROUP];
+
+	for (int chunkIndex = 0; chunkIndex < NUMBER_OF_CHUNKS_PER_GROUP; ++chunkIndex)
+	{
+		IntVector2 chunkOffset = IntVector2((chunkIndex % CHUNK_GROUP_WIDTH) - 1, (chunkIndex / CHUNK_GROUP_WIDTH) - 1);
+		IntVector2 chunkCoordinates = centreChunkCoordinates + chunkOffset;
+
+		comparisonProxy->m_ChunkCoordinates = chunkCoordinates;
+		comparisonProxy->m_HasInternalLight = false;
+		LoadChunkProxy(comparisonProxy, rleBuffer.data());
+		if (!comparisonProxy->m_HasInternalLight)
+		{
+			comparisonProxy->CalculateInternalLight(lightPropagationQueue);
+		}
+
+		comparisonChunks[chunkIndex] = new Chunk();
+		comparisonChunks[chunkIndex]->InitializeChunk(chunkCoordinates);
+		comparisonChunks[chunkIndex]->PopulateChunkFromChunkProxy(*comparisonProxy);
+	}
+
+	delete comparisonProxy;
+
+	for (int chunkIndex = 0; chunkIndex < NUMBER_OF_CHUNKS_PER_GROUP; ++chunkIndex)
+	{
+		int chunkX = chunkIndex % CHUNK_GROUP_WIDTH;
+		int chunkY = chunkIndex / CHUNK_GROUP_WIDTH;
+		Chunk* currentChunk = comparisonChunks[chunkIndex];
+
+		currentChunk->m_EasternNeighbour = (chunkX < CHUNK_GROUP_WIDTH - 1) ? comparisonChunks[chunkIndex + 1] : nullptr;
+		currentChunk->m_WesternNeighbour = (chunkX > 0) ? comparisonChunks[chunkIndex - 1] : nullptr;
+		currentChunk->m_NorthernNeighbour = (chunkY < CHUNK_GROUP_WIDTH - 1) ? comparisonChunks[chunkIndex + CHUNK_GROUP_WIDTH] : nullptr;
+		currentChunk->m_SouthernNeighbour = (chunkY > 0) ? comparisonChunks[chunkIndex - CHUNK_GROUP_WIDTH] : nullptr;
+	}
+
+	LightingEngine comparisonEngine;
+	for (Chunk* currentChunk : comparisonChunks)
+	{
+		comparisonEngine.StitchLightAcrossChunkBorders(currentChunk);
+	}
+
+	while (comparisonEngine.GetNumberOfPendingLightChanges() > 0U)
+	{
+		comparisonEngine.PropagateLightChanges(LIGHTING_BUDGET_IN_MICROSECONDS * 0.000001, MAXIMUM_LIGHT_UPDATES_PER_FRAME);
+	}
+
+	Chunk* centreChunk = comparisonChunks[NUMBER_OF_CHUNKS_PER_GROUP / 2];
+
+	std::vector<uint8_t> groupBlockTypes(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> groupSkyFlags(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> relaxedLightValues(NUMBER_OF_LIGHT_CHANNELS * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	comparisonEngine.CopyChunkGroupAroundChunk(centreChunk, groupBlockTypes.data(), groupSkyFlags.data(), relaxedLightValues.data());
+
+	size_t numberOfComparedEdits = 0U;
+	size_t numberOfMismatches = 0U;
+
+	for (int columnIndex = 0; columnIndex < NUMBER_OF_BLOCKS_PER_LAYER; columnIndex += LIGHTING_COMPARISON_COLUMN_STRIDE)
+	{
+		int columnHeight = centreChunk->GetColumnHeight(columnIndex);
+		if (columnHeight < 2 || columnHeight + 2 >= NUMBER_OF_BLOCKS_Z)
+		{
+			continue;
+		}
+
+		int topBlockIndex = ((columnHeight - 1) << BLOCK_BITS_PER_LAYER) + columnIndex;
+		int overhangBlockIndex = topBlockIndex + (3 * NUMBER_OF_BLOCKS_PER_LAYER);
+		if (centreChunk->GetBlockType(topBlockIndex) == BEDROCK_BLOCK)
+		{
+			continue;
+		}
+
+		numberOfMismatches += CompareLightingEditAgainstRelaxation(centreChunk, comparisonEngine, topBlockIndex, AIR_BLOCK, groupBlockTypes, groupSkyFlags, relaxedLightValues);
+		numberOfMismatches += CompareLightingEditAgainstRelaxation(centreChunk, comparisonEngine, topBlockIndex, GLOWSTONE_BLOCK, groupBlockTypes, groupSkyFlags, relaxedLightValues);
+		numberOfMismatches += CompareLightingEditAgainstRelaxation(centreChunk, comparisonEngine, overhangBlockIndex, STONE_BLOCK, groupBlockTypes, groupSkyFlags, relaxedLightValues);
+		numberOfMismatches += CompareLightingEditAgainstRelaxation(centreChunk, comparisonEngine, topBlockIndex, AIR_BLOCK, groupBlockTypes, groupSkyFlags, relaxedLightValues);
+		numberOfMismatches += CompareLightingEditAgainstRelaxation(centreChunk, comparisonEngine, overhangBlockIndex, AIR_BLOCK, groupBlockTypes, groupSkyFlags, relaxedLightValues);
+		numberOfComparedEdits += 5U;
+	}
+
+	for (Chunk* currentChunk : comparisonChunks)
+	{
+		delete currentChunk;
+	}
+
+	m_NumberOfComparedLightingEdits = numberOfComparedEdits;
+	m_NumberOfLightingMismatches = numberOfMismatches;
+}
+
+
+
+size_t World::CompareLightingEditAgainstRelaxation(Chunk* centreChunk, LightingEngine& comparisonEngine, int localIndex, uint8_t newBlockType, std::vector<uint8_t>& groupBlockTypes, std::vector<uint8_t>& groupSkyFlags, std::vector<uint8_t>& relaxedLightValues)
+{
+	int centreChunkIndex = NUMBER_OF_CHUNKS_PER_GROUP / 2;
+	int columnIndex = centreChunk->GetColumnIndexForLocalIndex(localIndex);
+	int editedGroupIndex = LightingEngine::GetGroupIndexForLocalIndex(centreChunkIndex, localIndex);
+
+	bool editIsDig = (newBlockType == AIR_BLOCK);
+	bool walkDownColumn = (editIsDig) ? centreChunk->IsSky(localIndex + NUMBER_OF_BLOCKS_PER_LAYER) : (groupSkyFlags[editedGroupIndex] != 0U);
+
+	int previousColumnHeight = centreChunk->GetColumnHeight(columnIndex);
+	centreChunk->SetBlockType(localIndex, newBlockType);
+	centreChunk->MarkBlockTypeAsChanged(localIndex);
+	comparisonEngine.MarkColumnForRelighting(BlockInfo(centreChunk, localIndex), previousColumnHeight);
+
+	while (comparisonEngine.GetNumberOfPendingLightChanges() > 0U)
+	{
+		comparisonEngine.PropagateLightChanges(LIGHTING_BUDGET_IN_MICROSECONDS * 0.000001, MAXIMUM_LIGHT_UPDATES_PER_FRAME);
+	}
+
+	if (editIsDig)
+	{
+		groupBlockTypes[editedGroupIndex] = newBlockType;
+	}
+
+	std::deque<int> dirtyBlockIndices;
+	if (walkDownColumn)
+	{
+		for (int groupIndex = editedGroupIndex; groupIndex >= 0 && !BlockDefinition::IsOpaque(groupBlockTypes[groupIndex]); groupIndex -= NUMBER_OF_BLOCKS_PER_GROUP_LAYER)
+		{
+			dirtyBlockIndices.push_back(groupIndex);
+		}
+	}
+	else
+	{
+		dirtyBlockIndices.push_back(editedGroupIndex);
+	}
+
+	groupBlockTypes[editedGroupIndex] = newBlockType;
+	for (int blockIndex = columnIndex; blockIndex < NUMBER_OF_BLOCKS_PER_CHUNK; blockIndex += NUMBER_OF_BLOCKS_PER_LAYER)
+	{
+		groupSkyFlags[LightingEngine::GetGroupIndexForLocalIndex(centreChunkIndex, blockIndex)] = centreChunk->IsSky(blockIndex) ? 1U : 0U;
+	}
+
+	for (uint8_t lightChannel = 0; lightChannel < NUMBER_OF_LIGHT_CHANNELS; ++lightChannel)
+	{
+		std::deque<int> channelDirtyBlockIndices = dirtyBlockIndices;
+		comparisonEngine.RelaxChunkGroupLight(groupBlockTypes.data(), groupSkyFlags.data(), lightChannel, &relaxedLightValues[lightChannel * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP], channelDirtyBlockIndices);
+	}
+
+	std::vector<uint8_t> engineBlockTypes(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> engineSkyFlags(NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	std::vector<uint8_t> engineLightValues(NUMBER_OF_LIGHT_CHANNELS * NUMBER_OF_BLOCKS_PER_CHUNK_GROUP);
+	comparisonEngine.CopyChunkGroupAroundChunk(centreChunk, engineBlockTypes.data(), engineSkyFlags.data(), engineLightValues.data());
+
+	size_t numberOfMismatches = 0U;
+	for (size_t lightIndex = 0; lightIndex < engineLightValues.size(); ++lightIndex)
+	{
+		if (engineLightValues[lightIndex] != relaxedLightValues[lightIndex])
+		{
+			++numberOfMismatches;
+		}
+	}
+
+	relaxedLightValues.swap(engineLightValues);
+	return numberOfMismatches;
+}
+
+
+
 void World::OnePlayerUpdateCall(float deltaTimeInSeconds)
 {
 	if (m_PlayerOne->IsAlive())
@@ -542,7 +951,7 @@ void World::OnePlayerUpdateCall(float deltaTimeInSeconds)
 		FirePlayerBullets(m_PlayerOne, PLAYER_ONE, deltaTimeInSeconds);
 	}
 
-	UpdateChunkManagement();
+	UpdateChunkManagement(deltaTimeInSeconds);
 
 	if (m_PlayerOne->IsAlive())
 	{
@@ -569,7 +978,7 @@ void World::TwoPlayerUpdateCall(float deltaTimeInSeconds)
 		FirePlayerBullets(m_PlayerTwo, PLAYER_TWO, deltaTimeInSeconds);
 	}
 
-	UpdateChunkManagement();
+	UpdateChunkManagement(deltaTimeInSeconds);
 
 	if (m_PlayerOne->IsAlive())
 	{
@@ -614,120 +1023,220 @@ void World::TwoPlayerRenderCall() const
 
 
 
-void World::ProcessChunkManagement(void*)
+void World::ProcessChunkManagement(void* workerData)
 {
-	size_t proxyArraySize = MAXIMUM_NUMBER_OF_CHUNKS * sizeof(ChunkProxy);
-	
-	while (g_WorldIsActive)
+	size_t workerIndex = reinterpret_cast<size_t>(workerData);
+	std::vector<uint8_t> rleBuffer(MAXIMUM_RLE_BUFFER_SIZE);
+	std::vector<uint16_t> lightPropagationQueue;
+	ChunkMeshScratchArena meshScratchArena;
+
+	for (;;)
 	{
-		size_t numberOfActivatedChunks = 0U;
+		ChunkRequest incomingRequest;
 
-		EnterCriticalSection(&g_ChunkLoadingCriticalSection);
+		while (g_SaveRequestQueue.Pop(incomingRequest))
 		{
-			ChunkProxy* temporaryPointer = g_SharedLoadedChunkProxies;
-			g_SharedLoadedChunkProxies = g_LocalLoadedChunkProxies;
-			g_LocalLoadedChunkProxies = temporaryPointer;
+			g_SaveQueueStatistics.RecordQueueDepth(g_SaveRequestQueue.GetSize());
+			g_ChunkWorkerPool.AddJob(workerIndex, ChunkJob(SAVE_CHUNK_JOB, incomingRequest));
+		}
 
-			numberOfActivatedChunks = g_NumberOfActivatedChunks;
-			g_NumberOfActivatedChunks = 0U;
+		while (g_MeshRequestQueue.Pop(incomingRequest))
+		{
+			g_MeshQueueStatistics.RecordQueueDepth(g_MeshRequestQueue.GetSize());
+			g_ChunkWorkerPool.AddJob(workerIndex, ChunkJob(MESH_CHUNK_JOB, incomingRequest));
+		}
+
+		while (g_LoadRequestQueue.Pop(incomingRequest))
+		{
+			g_LoadQueueStatistics.RecordQueueDepth(g_LoadRequestQueue.GetSize());
+			g_ChunkWorkerPool.AddJob(workerIndex, ChunkJob(LOAD_CHUNK_JOB, incomingRequest));
 		}
-		LeaveCriticalSection(&g_ChunkLoadingCriticalSection);
-		
-		size_t numberOfDeactivatedChunks = 0U;
 
-		EnterCriticalSection(&g_ChunkSavingCriticalSection);
+		ChunkJob currentJob;
+		if (!g_ChunkWorkerPool.TakeJob(workerIndex, currentJob))
 		{
-			ChunkProxy* temporaryPointer = g_SharedSavedChunkProxies;
-			g_SharedSavedChunkProxies = g_LocalSavedChunkProxies;
-			g_LocalSavedChunkProxies = temporaryPointer;
+			if (g_ChunkWorkerPool.IsShuttingDown())
+			{
+				break;
+			}
 
-			numberOfDeactivatedChunks = g_NumberOfSavedChunks;
-			g_NumberOfSavedChunks = 0U;
+			g_ChunkWorkerPool.WaitForWork();
+			continue;
 		}
-		LeaveCriticalSection(&g_ChunkSavingCriticalSection);
 
-		if (numberOfActivatedChunks > 0U)
+		ChunkRequest& currentRequest = currentJob.m_Request;
+
+		switch (currentJob.m_JobType)
 		{
-			size_t numberOfPopulatedChunks = 0U;
-			for (size_t chunkProxyIndex = 0; chunkProxyIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkProxyIndex)
+		case LOAD_CHUNK_JOB:
+			if (g_ChunkWorkerPool.IsShuttingDown())
 			{
-				ChunkProxy& currentChunkProxy = g_LocalLoadedChunkProxies[chunkProxyIndex];
-				if (!currentChunkProxy.m_IsValid)
+				g_ChunkProxyPool.DeallocateChunkProxy(currentRequest.m_ChunkProxy);
+				break;
+			}
+
+			if (g_ChunkWorkerPool.ChunkIsBeyondFlushRadius(currentRequest.m_ChunkCoordinates))
+			{
+				currentRequest.m_IsCancelled = true;
+				g_LoadQueueStatistics.RecordCancelledRequest();
+			}
+			else if (g_ChunkWorkerPool.ParkJobBehindPendingSave(currentJob))
+			{
+				break;
+			}
+			else
+			{
+				LoadChunkProxy(currentRequest.m_ChunkProxy, rleBuffer.data());
+				if (!currentRequest.m_ChunkProxy->m_HasInternalLight)
 				{
-					continue;
+					currentRequest.m_ChunkProxy->CalculateInternalLight(lightPropagationQueue);
 				}
+			}
 
-				IntVector2 currentChunkCoordinates = currentChunkProxy.m_ChunkCoordinates;
+			while (!g_PopulatedChunkQueue.Push(currentRequest))
+			{
+				Thread::YieldThread();
+			}
 
-				char chunkFilePath[128];
-				sprintf_s(chunkFilePath, "Data/SaveSlot/Region_0/Chunk_(%i, %i).chunk", currentChunkCoordinates.X, currentChunkCoordinates.Y);
+			g_PopulatedQueueStatistics.RecordQueueDepth(g_PopulatedChunkQueue.GetSize());
+			break;
 
-				BinaryFileReader fileReader;
-				bool fileExists = fileReader.OpenBinaryFile(chunkFilePath);
+		case SAVE_CHUNK_JOB:
+			if (!currentRequest.m_ChunkProxy->m_HasInternalLight)
+			{
+				currentRequest.m_ChunkProxy->CalculateInternalLight(lightPropagationQueue);
+			}
 
-				if (fileExists)
-				{
-					size_t fileSize = fileReader.GetBinaryFileSize();
-					fileSize = fileReader.ReadBytes(g_RLEBuffer, fileSize);
+			SaveChunkProxy(currentRequest.m_ChunkProxy, rleBuffer.data());
+			g_ChunkWorkerPool.MarkSaveAsCompleted(currentRequest.m_ChunkCoordinates);
+			g_SaveQueueStatistics.RecordCompletedRequest(currentRequest);
 
-					currentChunkProxy.DecompressFromRLEBuffer(g_RLEBuffer, fileSize);
-					fileReader.CloseBinaryFile();
-				}
-				else
-				{
-					currentChunkProxy.PopulateFromPerlinNoise();
-				}
+			g_ChunkProxyPool.DeallocateChunkProxy(currentRequest.m_ChunkProxy);
+			break;
 
-				++numberOfPopulatedChunks;
+		case MESH_CHUNK_JOB:
+			if (g_ChunkWorkerPool.IsShuttingDown())
+			{
+				g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(currentRequest.m_MeshSnapshot);
+				break;
 			}
 
-			EnterCriticalSection(&g_ChunkPopulatingCriticalSection);
-			{
-				ChunkProxy* temporaryPointer = g_LocalLoadedChunkProxies;
-				g_LocalLoadedChunkProxies = g_SharedPopulatedChunkProxies;
-				g_SharedPopulatedChunkProxies = temporaryPointer;
+			currentRequest.m_MeshSnapshot->BuildChunkMesh(meshScratchArena);
+			currentRequest.m_MeshSnapshot->BuildWaterMesh(meshScratchArena);
 
-				g_NumberOfPopulatedChunks = numberOfPopulatedChunks;
+			while (!g_MeshedChunkQueue.Push(currentRequest))
+			{
+				Thread::YieldThread();
 			}
-			LeaveCriticalSection(&g_ChunkPopulatingCriticalSection);
+			break;
+
+		default:
+			break;
 		}
+	}
+
+	g_ChunkWorkerPool.MarkWorkerAsStopped();
+}
+
 
-		if (numberOfDeactivatedChunks > 0U)
+
+void World::FinishRemainingChunkJobs()
+{
+	std::vector<uint8_t> rleBuffer(MAXIMUM_RLE_BUFFER_SIZE);
+	std::vector<uint16_t> lightPropagationQueue;
+
+	ChunkJob remainingJob;
+	while (g_ChunkWorkerPool.TakeRemainingJob(remainingJob))
+	{
+		ChunkRequest& remainingRequest = remainingJob.m_Request;
+
+		switch (remainingJob.m_JobType)
 		{
-			for (size_t chunkProxyIndex = 0; chunkProxyIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkProxyIndex)
+		case LOAD_CHUNK_JOB:
+			g_LoadQueueStatistics.RecordCancelledRequest();
+			g_ChunkProxyPool.DeallocateChunkProxy(remainingRequest.m_ChunkProxy);
+			break;
+
+		case SAVE_CHUNK_JOB:
+			if (!remainingRequest.m_ChunkProxy->m_HasInternalLight)
 			{
-				ChunkProxy currentChunkProxy = g_LocalSavedChunkProxies[chunkProxyIndex];
-				if (!currentChunkProxy.m_IsValid)
-				{
-					continue;
-				}
+				remainingRequest.m_ChunkProxy->CalculateInternalLight(lightPropagationQueue);
+			}
 
-				IntVector2 currentChunkCoordinates = currentChunkProxy.m_ChunkCoordinates;
+			SaveChunkProxy(remainingRequest.m_ChunkProxy, rleBuffer.data());
+			g_ChunkWorkerPool.MarkSaveAsCompleted(remainingRequest.m_ChunkCoordinates);
+			g_SaveQueueStatistics.RecordCompletedRequest(remainingRequest);
 
-				char chunkFilePath[128];
-				sprintf_s(chunkFilePath, "Data/SaveSlot/Region_0/Chunk_(%i, %i).chunk", currentChunkCoordinates.X, currentChunkCoordinates.Y);
+			g_ChunkProxyPool.DeallocateChunkProxy(remainingRequest.m_ChunkProxy);
+			break;
 
-				size_t bufferSize = 0U;
-				currentChunkProxy.CompressToRLEBuffer(g_RLEBuffer, bufferSize);
+		case MESH_CHUNK_JOB:
+			g_MeshQueueStatistics.RecordCancelledRequest();
+			g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(remainingRequest.m_MeshSnapshot);
+			break;
 
-				BinaryFileWriter fileWriter;
-				fileWriter.OpenBinaryFile(chunkFilePath);
-				fileWriter.WriteBytes(g_RLEBuffer, bufferSize);
-				fileWriter.CloseBinaryFile();
-			}
+		default:
+			break;
+		}
+	}
+}
+
+
+
+void World::LoadChunkProxy(ChunkProxy* currentChunkProxy, uint8_t* rleBuffer)
+{
+	IntVector2 currentChunkCoordinates = currentChunkProxy->m_ChunkCoordinates;
+
+	char chunkFilePath[128];
+	sprintf_s(chunkFilePath, "Data/SaveSlot/Region_0/Chunk_(%i, %i).chunk", currentChunkCoordinates.X, currentChunkCoordinates.Y);
+
+	BinaryFileReader fileReader;
+	bool fileExists = fileReader.OpenBinaryFile(chunkFilePath);
 
-			memset(g_LocalSavedChunkProxies, 0, proxyArraySize);
+	if (fileExists)
+	{
+		size_t fileSize = fileReader.GetBinaryFileSize();
+		if (fileSize > MAXIMUM_RLE_BUFFER_SIZE)
+		{
+			fileSize = MAXIMUM_RLE_BUFFER_SIZE;
 		}
 
-		Thread::YieldThread();
+		fileSize = fileReader.ReadBytes(rleBuffer, fileSize);
+
+		currentChunkProxy->DecompressFromRLEBuffer(rleBuffer, fileSize);
+		fileReader.CloseBinaryFile();
+	}
+	else
+	{
+		currentChunkProxy->PopulateFromPerlinNoise();
 	}
 }
 
 
 
-void World::UpdateChunkManagement()
+void World::SaveChunkProxy(ChunkProxy* currentChunkProxy, uint8_t* rleBuffer)
 {
-	ActivateNearestMissingChunk();
+	IntVector2 currentChunkCoordinates = currentChunkProxy->m_ChunkCoordinates;
+
+	char chunkFilePath[128];
+	sprintf_s(chunkFilePath, "Data/SaveSlot/Region_0/Chunk_(%i, %i).chunk", currentChunkCoordinates.X, currentChunkCoordinates.Y);
+
+	size_t bufferSize = 0U;
+	currentChunkProxy->CompressToRLEBuffer(rleBuffer, bufferSize);
+
+	BinaryFileWriter fileWriter;
+	fileWriter.OpenBinaryFile(chunkFilePath);
+	fileWriter.WriteBytes(rleBuffer, bufferSize);
+	fileWriter.CloseBinaryFile();
+}
+
+
+
+void World::UpdateChunkManagement(float deltaTimeInSeconds)
+{
+	UpdateStreamingVelocities(deltaTimeInSeconds);
+	UpdateBlockStorageMode();
+	ActivateNearestMissingChunks();
 	PopulateLoadedChunks();
 	DeactivateFarthestChunk();
 }
@@ -884,9 +1393,9 @@ void World::DestroyAllOutdatedAndImpactedBullets()
 		{
 			bulletHasToBeDestroyed = true;
 		}
-		else if (currentBulletBlockInfo.GetBlock() != nullptr)
+		else if (currentBulletBlockInfo.GetChunk() != nullptr)
 		{
-			if (currentBulletBlockInfo.GetBlock()->IsSolid())
+			if (currentBulletBlockInfo.GetBlock().IsSolid())
 			{
 				bulletHasToBeDestroyed = true;
 			}
@@ -1348,151 +1857,302 @@ void World::CreateSkyboxMesh()
 
 Chunk* World::CreateChunk(const IntVector2& chunkCoordinates)
 {
-	if (m_NumberOfActiveChunks > MAXIMUM_NUMBER_OF_CHUNKS)
+	if (m_FreeChunkSlots.empty())
 	{
 		return nullptr;
 	}
 	
 	Chunk* createdChunk = m_ChunkPool.AllocateObjectFromPool();
 	createdChunk->InitializeChunk(chunkCoordinates);
+	createdChunk->SetUsesPalettedBlockStorage(m_PalettedBlockStorageIsEnabled);
+
+	size_t chunkSlotIndex = m_FreeChunkSlots.back();
+	m_FreeChunkSlots.pop_back();
+
+	ASSERT_OR_DIE(m_AllChunks[chunkSlotIndex] == nullptr, "Chunk Error.");
+
+	createdChunk->SetChunkSlotIndex(chunkSlotIndex);
+	m_AllChunks[chunkSlotIndex] = createdChunk;
+
+	bool insertedSuccessfully = m_ActiveChunkMap.InsertChunk(createdChunk);
+	ASSERT_OR_DIE(insertedSuccessfully, "Chunk Map Error.");
+
+	++m_NumberOfActiveChunks;
+
+	return createdChunk;
+}
+
+
+
+void World::DestroyChunk(Chunk* currentChunk)
+{
+	size_t chunkSlotIndex = currentChunk->GetChunkSlotIndex();
+	ASSERT_OR_DIE(m_AllChunks[chunkSlotIndex] == currentChunk, "Chunk Error.");
+
+	m_NumberOfChunkMeshVertices -= currentChunk->GetNumberOfMeshVertices();
+	m_NumberOfChunkMeshIndices -= currentChunk->GetNumberOfMeshIndices();
+
+	bool removedSuccessfully = m_ActiveChunkMap.RemoveChunk(currentChunk->GetChunkCoordinates());
+	ASSERT_OR_DIE(removedSuccessfully, "Chunk Map Error.");
+
+	m_LightingEngine.DiscardLightChangesForChunk(currentChunk);
+	m_ChunkPool.DeallocateObjectToPool(currentChunk);
+	m_AllChunks[chunkSlotIndex] = nullptr;
+	m_FreeChunkSlots.push_back(chunkSlotIndex);
+
+	--m_NumberOfActiveChunks;
+}
+
+
+
+void World::GenerateChunkActivationOffsets(int activationRadius)
+{
+	m_ChunkActivationOffsets.clear();
+	m_ChunkActivationSquaredDistances.clear();
 
-	size_t availableIndex = 0U;
-	bool availableIndexFound = false;
-	for (size_t chunkIndex = 0; chunkIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkIndex)
+	int squaredActivationRadius = activationRadius * activationRadius;
+
+	for (int squaredDistance = 0; squaredDistance < squaredActivationRadius; ++squaredDistance)
 	{
-		if (m_AllChunks[chunkIndex] == nullptr)
+		for (int offsetY = -activationRadius; offsetY <= activationRadius; ++offsetY)
 		{
-			availableIndex = chunkIndex;
-			availableIndexFound = true;
-			break;
+			for (int offsetX = -activationRadius; offsetX <= activationRadius; ++offsetX)
+			{
+				if ((offsetX * offsetX) + (offsetY * offsetY) == squaredDistance)
+				{
+					m_ChunkActivationOffsets.push_back(IntVector2(offsetX, offsetY));
+					m_ChunkActivationSquaredDistances.push_back(squaredDistance);
+				}
+			}
 		}
 	}
 
-	ASSERT_OR_DIE(availableIndexFound, "Chunk Error.");
-
-	if (availableIndexFound)
+	for (size_t playerIndex = 0; playerIndex < NUMBER_OF_PLAYERS; ++playerIndex)
 	{
-		m_AllChunks[availableIndex] = createdChunk;
-		++m_NumberOfActiveChunks;
+		m_ChunkActivationCursors[playerIndex] = 0U;
+		m_ChunkActivationCentres[playerIndex] = IntVector2::ZERO;
 	}
-
-	return createdChunk;
 }
 
 
 
-void World::DestroyChunk(Chunk* currentChunk)
+void World::UpdateStreamingVelocities(float deltaTimeInSeconds)
 {
-	for (size_t chunkIndex = 0; chunkIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkIndex)
+	const Player* allPlayers[NUMBER_OF_PLAYERS] = { m_PlayerOne, m_PlayerTwo };
+	size_t numberOfPlayers = (g_TwoPlayerMode) ? NUMBER_OF_PLAYERS : 1U;
+
+	IntVector2 streamingCentres[NUMBER_OF_PLAYERS];
+
+	for (size_t playerIndex = 0; playerIndex < numberOfPlayers; ++playerIndex)
 	{
-		if (m_AllChunks[chunkIndex] == currentChunk)
-		{
-			m_ChunkPool.DeallocateObjectToPool(currentChunk);
-			m_AllChunks[chunkIndex] = nullptr;
+		Vector3 playerPosition = allPlayers[playerIndex]->m_Position;
 
-			--m_NumberOfActiveChunks;
+		if (deltaTimeInSeconds > 0.0f)
+		{
+			m_StreamingVelocities[playerIndex] = (playerPosition - m_PreviousStreamingPositions[playerIndex]) * (1.0f / deltaTimeInSeconds);
 		}
+
+		m_PreviousStreamingPositions[playerIndex] = playerPosition;
+		streamingCentres[playerIndex] = GetChunkCoordinatesForWorldCoordinates(playerPosition);
 	}
+
+	g_ChunkWorkerPool.SetStreamingCentres(streamingCentres, numberOfPlayers);
 }
 
 
 
-void World::ActivateNearestMissingChunk()
+IntVector2 World::GetPrefetchChunkCoordinatesForPlayer(const Player* currentPlayer, uint8_t currentPlayerID) const
 {
-	bool playerOneChunkIsNeeded = false;
-	IntVector2 playerOneChunkCoordinates = IntVector2::ZERO;
-	float playerOneShortestSquaredDistance = FLT_MAX;
+	IntVector2 currentChunkCoordinates = GetChunkCoordinatesForWorldCoordinates(currentPlayer->m_Position);
 
-	bool playerTwoChunkIsNeeded = false;
-	IntVector2 playerTwoChunkCoordinates = IntVector2::ZERO;
-	float playerTwoShortestSquaredDistance = FLT_MAX;
+	Vector3 predictedPosition = currentPlayer->m_Position + (m_StreamingVelocities[currentPlayerID] * CHUNK_PREFETCH_TIME_IN_SECONDS);
+	IntVector2 predictedChunkCoordinates = GetChunkCoordinatesForWorldCoordinates(predictedPosition);
 
-	playerOneChunkIsNeeded = FindNearestMissingChunk(playerOneChunkCoordinates, playerOneShortestSquaredDistance, m_PlayerOne);
+	int prefetchOffsetX = ClampInt(predictedChunkCoordinates.X - currentChunkCoordinates.X, -MAXIMUM_CHUNK_PREFETCH_DISTANCE, MAXIMUM_CHUNK_PREFETCH_DISTANCE);
+	int prefetchOffsetY = ClampInt(predictedChunkCoordinates.Y - currentChunkCoordinates.Y, -MAXIMUM_CHUNK_PREFETCH_DISTANCE, MAXIMUM_CHUNK_PREFETCH_DISTANCE);
 
-	if (g_TwoPlayerMode)
+	return IntVector2(currentChunkCoordinates.X + prefetchOffsetX, currentChunkCoordinates.Y + prefetchOffsetY);
+}
+
+
+
+float World::GetStreamingPriorityForChunkOffset(size_t activationIndex, const Vector2& viewDirection, const Vector2& movementDirection) const
+{
+	int squaredDistance = m_ChunkActivationSquaredDistances[activationIndex];
+	if (squaredDistance == 0)
 	{
-		playerTwoChunkIsNeeded = FindNearestMissingChunk(playerTwoChunkCoordinates, playerTwoShortestSquaredDistance, m_PlayerTwo);
+		return 0.0f;
 	}
 
-	if (playerOneChunkIsNeeded || playerTwoChunkIsNeeded)
+	const IntVector2& activationOffset = m_ChunkActivationOffsets[activationIndex];
+	float inverseDistance = 1.0f / sqrtf(static_cast<float>(squaredDistance));
+
+	float offsetDirectionX = static_cast<float>(activationOffset.X) * inverseDistance;
+	float offsetDirectionY = static_cast<float>(activationOffset.Y) * inverseDistance;
+
+	float viewAlignment = GetMaximumOfTwoFloats((offsetDirectionX * viewDirection.X) + (offsetDirectionY * viewDirection.Y), 0.0f);
+	float movementAlignment = GetMaximumOfTwoFloats((offsetDirectionX * movementDirection.X) + (offsetDirectionY * movementDirection.Y), 0.0f);
+
+	float directionalWeight = 1.0f - (VIEW_DIRECTION_PRIORITY_WEIGHT * viewAlignment) - (MOVEMENT_DIRECTION_PRIORITY_WEIGHT * movementAlignment);
+
+	return static_cast<float>(squaredDistance) * directionalWeight;
+}
+
+
+
+void World::ActivateNearestMissingChunks()
+{
+	double activationStartTime = GetCurrentTimeInSeconds();
+	double activationBudgetInSeconds = CHUNK_ACTIVATION_BUDGET_IN_MICROSECONDS * 0.000001;
+
+	for (size_t activationIndex = 0; activationIndex < MAXIMUM_CHUNK_ACTIVATIONS_PER_FRAME; ++activationIndex)
 	{
-		IntVector2 mostUrgentMissingChunkCoordinates;
+		bool playerOneChunkIsNeeded = false;
+		IntVector2 playerOneChunkCoordinates = IntVector2::ZERO;
+		float playerOneHighestPriority = FLT_MAX;
 
-		float overallShortestDistance = GetMinimumOfTwoFloats(playerOneShortestSquaredDistance, playerTwoShortestSquaredDistance);
+		bool playerTwoChunkIsNeeded = false;
+		IntVector2 playerTwoChunkCoordinates = IntVector2::ZERO;
+		float playerTwoHighestPriority = FLT_MAX;
 
-		if (overallShortestDistance == playerOneShortestSquaredDistance)
-		{
-			mostUrgentMissingChunkCoordinates = playerOneChunkCoordinates;
-		}
-		else if (overallShortestDistance == playerTwoShortestSquaredDistance)
+		playerOneChunkIsNeeded = FindNearestMissingChunk(playerOneChunkCoordinates, playerOneHighestPriority, m_PlayerOne, PLAYER_ONE);
+
+		if (g_TwoPlayerMode)
 		{
-			mostUrgentMissingChunkCoordinates = playerTwoChunkCoordinates;
+			playerTwoChunkIsNeeded = FindNearestMissingChunk(playerTwoChunkCoordinates, playerTwoHighestPriority, m_PlayerTwo, PLAYER_TWO);
 		}
 
-		Chunk* activatedChunk = CreateChunk(mostUrgentMissingChunkCoordinates);
-		if (activatedChunk == nullptr)
+		if (!playerOneChunkIsNeeded && !playerTwoChunkIsNeeded)
 		{
 			return;
 		}
 
-		ChunkProxy activatedChunkProxy = activatedChunk->GetChunkProxyFromChunk();
-		bool addedSuccessfully = false;
+		IntVector2 mostUrgentMissingChunkCoordinates = playerTwoChunkCoordinates;
+		float loadPriority = playerTwoHighestPriority;
+
+		if (playerOneChunkIsNeeded && (!playerTwoChunkIsNeeded || playerOneHighestPriority <= playerTwoHighestPriority))
+		{
+			mostUrgentMissingChunkCoordinates = playerOneChunkCoordinates;
+			loadPriority = playerOneHighestPriority;
+		}
 
-		EnterCriticalSection(&g_ChunkLoadingCriticalSection);
+		if (!ActivateChunk(mostUrgentMissingChunkCoordinates, loadPriority))
 		{
-			addedSuccessfully = AddToSharedLoadedChunkProxies(activatedChunkProxy);
+			return;
 		}
-		LeaveCriticalSection(&g_ChunkLoadingCriticalSection);
 
-		if (!addedSuccessfully)
+		if (GetCurrentTimeInSeconds() - activationStartTime > activationBudgetInSeconds)
 		{
-			DestroyChunk(activatedChunk);
+			return;
 		}
 	}
 }
 
 
 
-bool World::FindNearestMissingChunk(IntVector2& chunkCoordinates, float& lowestPossibleSquaredDistance, const Player* currentPlayer)
+bool World::FindNearestMissingChunk(IntVector2& chunkCoordinates, float& highestPossiblePriority, const Player* currentPlayer, uint8_t currentPlayerID)
 {
-	Vector3 playerPosition = currentPlayer->m_Position;
-	IntVector2 currentChunkCoordinates = GetChunkCoordinatesForWorldCoordinates(playerPosition);
-	Vector2 playerPositionXY = Vector2(playerPosition.X, playerPosition.Y);
+	IntVector2 prefetchChunkCoordinates = GetPrefetchChunkCoordinatesForPlayer(currentPlayer, currentPlayerID);
 
-	float shortestSquaredDistance = SQUARED_ACTIVATION_DISTANCE;
+	if (prefetchChunkCoordinates != m_ChunkActivationCentres[currentPlayerID])
+	{
+		m_ChunkActivationCentres[currentPlayerID] = prefetchChunkCoordinates;
+		m_ChunkActivationCursors[currentPlayerID] = 0U;
+	}
 
-	int minimumChunkRangeX = currentChunkCoordinates.X - ACTIVE_CHUNK_RADIUS;
-	int maximumChunkRangeX = currentChunkCoordinates.X + ACTIVE_CHUNK_RADIUS;
+	size_t& activationCursor = m_ChunkActivationCursors[currentPlayerID];
+	size_t numberOfActivationOffsets = m_ChunkActivationOffsets.size();
 
-	int minimumChunkRangeY = currentChunkCoordinates.Y - ACTIVE_CHUNK_RADIUS;
-	int maximumChunkRangeY = currentChunkCoordinates.Y + ACTIVE_CHUNK_RADIUS;
+	while (activationCursor < numberOfActivationOffsets)
+	{
+		const IntVector2& activationOffset = m_ChunkActivationOffsets[activationCursor];
+		IntVector2 missingChunkCoordinates = IntVector2(prefetchChunkCoordinates.X + activationOffset.X, prefetchChunkCoordinates.Y + activationOffset.Y);
 
-	for (int chunkIndexX = minimumChunkRangeX; chunkIndexX <= maximumChunkRangeX; ++chunkIndexX)
+		if (FindActiveChunkWithCoordinates(missingChunkCoordinates) == nullptr)
+		{
+			break;
+		}
+
+		++activationCursor;
+	}
+
+	if (activationCursor >= numberOfActivationOffsets)
 	{
-		for (int chunkIndexY = minimumChunkRangeY; chunkIndexY <= maximumChunkRangeY; ++chunkIndexY)
+		return false;
+	}
+
+	Vector2 viewDirection = Vector2(currentPlayer->m_ForwardXY.X, currentPlayer->m_ForwardXY.Y);
+
+	Vector2 movementDirection = Vector2::ZERO;
+	Vector3 streamingVelocity = m_StreamingVelocities[currentPlayerID];
+	float squaredHorizontalSpeed = (streamingVelocity.X * streamingVelocity.X) + (streamingVelocity.Y * streamingVelocity.Y);
+
+	if (squaredHorizontalSpeed > 1.0f)
+	{
+		float inverseHorizontalSpeed = 1.0f / sqrtf(squaredHorizontalSpeed);
+		movementDirection = Vector2(streamingVelocity.X * inverseHorizontalSpeed, streamingVelocity.Y * inverseHorizontalSpeed);
+	}
+
+	size_t windowEnd = activationCursor + CHUNK_ACTIVATION_WINDOW_SIZE;
+	if (windowEnd > numberOfActivationOffsets)
+	{
+		windowEnd = numberOfActivationOffsets;
+	}
+
+	highestPossiblePriority = FLT_MAX;
+
+	for (size_t activationIndex = activationCursor; activationIndex < windowEnd; ++activationIndex)
+	{
+		const IntVector2& activationOffset = m_ChunkActivationOffsets[activationIndex];
+		IntVector2 missingChunkCoordinates = IntVector2(prefetchChunkCoordinates.X + activationOffset.X, prefetchChunkCoordinates.Y + activationOffset.Y);
+
+		if (FindActiveChunkWithCoordinates(missingChunkCoordinates) != nullptr)
 		{
-			IntVector2 missingChunkCoordinates = IntVector2(chunkIndexX, chunkIndexY);
-			Vector2 missingChunkCentre = GetChunkWorldCentreForChunkCoordinates(missingChunkCoordinates);
+			continue;
+		}
 
-			float squaredDistanceToChunk = CalculateEuclidianSquaredDistanceIn2D(playerPositionXY, missingChunkCentre);
-			if (squaredDistanceToChunk < shortestSquaredDistance)
-			{
-				if (FindActiveChunkWithCoordinates(missingChunkCoordinates) == nullptr)
-				{
-					shortestSquaredDistance = squaredDistanceToChunk;
-					chunkCoordinates = missingChunkCoordinates;
-					lowestPossibleSquaredDistance = shortestSquaredDistance;
-				}
-			}
+		float streamingPriority = GetStreamingPriorityForChunkOffset(activationIndex, viewDirection, movementDirection);
+		if (streamingPriority < highestPossiblePriority)
+		{
+			highestPossiblePriority = streamingPriority;
+			chunkCoordinates = missingChunkCoordinates;
 		}
 	}
 
-	if (shortestSquaredDistance < SQUARED_ACTIVATION_DISTANCE)
+	return true;
+}
+
+
+
+bool World::ActivateChunk(const IntVector2& chunkCoordinates, float loadPriority)
+{
+	Chunk* activatedChunk = CreateChunk(chunkCoordinates);
+	if (activatedChunk == nullptr)
 	{
-		return true;
+		return false;
 	}
 
-	return false;
+	ChunkProxy* activatedChunkProxy = g_ChunkProxyPool.AllocateChunkProxy(chunkCoordinates);
+	if (activatedChunkProxy == nullptr)
+	{
+		DestroyChunk(activatedChunk);
+		return false;
+	}
+
+	bool addedSuccessfully = g_LoadRequestQueue.Push(ChunkRequest(chunkCoordinates, activatedChunkProxy, loadPriority));
+	g_LoadQueueStatistics.RecordQueueDepth(g_LoadRequestQueue.GetSize());
+
+	if (!addedSuccessfully)
+	{
+		g_ChunkProxyPool.DeallocateChunkProxy(activatedChunkProxy);
+		DestroyChunk(activatedChunk);
+	}
+	else
+	{
+		g_ChunkWorkerPool.SignalWorkIsAvailable();
+	}
+
+	return addedSuccessfully;
 }
 
 
@@ -1550,21 +2210,41 @@ void World::DeactivateFarthestChunk()
 
 	if (chunkFound)
 	{
-		Chunk* foundChunk = FindActiveChunkWithCoordinates(chunkCoordinates);
-		ChunkProxy foundChunkProxy = foundChunk->GetChunkProxyFromChunk();
+		ChunkProxy* foundChunkProxy = g_ChunkProxyPool.AllocateChunkProxy(chunkCoordinates);
+		if (foundChunkProxy == nullptr)
+		{
+			return;
+		}
 
-		bool addedSuccessfully = false;
-		EnterCriticalSection(&g_ChunkSavingCriticalSection);
+		Chunk* foundChunk = FindActiveChunkWithCoordinates(chunkCoordinates);
+		if (!foundChunk->IsPopulated())
 		{
-			addedSuccessfully = AddToSharedSavedChunkProxies(foundChunkProxy);
+			g_ChunkProxyPool.DeallocateChunkProxy(foundChunkProxy);
+
+			DisconnectChunk(foundChunk);
+			DestroyChunk(foundChunk);
+			return;
 		}
-		LeaveCriticalSection(&g_ChunkSavingCriticalSection);
+
+		foundChunk->PopulateChunkProxyFromChunk(*foundChunkProxy);
+
+		g_ChunkWorkerPool.MarkSaveAsPending(chunkCoordinates);
+
+		bool addedSuccessfully = g_SaveRequestQueue.Push(ChunkRequest(chunkCoordinates, foundChunkProxy, 0.0f));
+		g_SaveQueueStatistics.RecordQueueDepth(g_SaveRequestQueue.GetSize());
 
 		if (addedSuccessfully)
 		{
+			g_ChunkWorkerPool.SignalWorkIsAvailable();
+
 			DisconnectChunk(foundChunk);
 			DestroyChunk(foundChunk);
 		}
+		else
+		{
+			g_ChunkWorkerPool.MarkSaveAsCompleted(chunkCoordinates);
+			g_ChunkProxyPool.DeallocateChunkProxy(foundChunkProxy);
+		}
 	}
 }
 
@@ -1663,437 +2343,367 @@ void World::DisconnectChunk(Chunk* currentChunk)
 
 void World::PopulateLoadedChunks()
 {
-	size_t proxyArraySize = MAXIMUM_NUMBER_OF_CHUNKS * sizeof(ChunkProxy);
-	size_t numberOfPopulatedChunks = 0U;
-	
-	EnterCriticalSection(&g_ChunkPopulatingCriticalSection);
-	{
-		ChunkProxy* temporaryPointer = g_SharedPopulatedChunkProxies;
-		g_SharedPopulatedChunkProxies = g_LocalPopulatedChunkProxies;
-		g_LocalPopulatedChunkProxies = temporaryPointer;
-
-		numberOfPopulatedChunks = g_NumberOfPopulatedChunks;
-		g_NumberOfPopulatedChunks = 0U;
-	}
-	LeaveCriticalSection(&g_ChunkPopulatingCriticalSection);
+	ChunkRequest populatedRequest;
 
-	if (numberOfPopulatedChunks > 0U)
+	while (g_PopulatedChunkQueue.Pop(populatedRequest))
 	{
-		for (size_t chunkProxyIndex = 0; chunkProxyIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkProxyIndex)
-		{
-			ChunkProxy currentProxy = g_LocalPopulatedChunkProxies[chunkProxyIndex];
-			if (!currentProxy.m_IsValid)
-			{
-				continue;
-			}
+		g_PopulatedQueueStatistics.RecordQueueDepth(g_PopulatedChunkQueue.GetSize());
 
-			Chunk* desiredChunk = nullptr;
-			for (Chunk* currentChunk : m_AllChunks)
-			{
-				if (currentChunk == nullptr)
-				{
-					continue;
-				}
-				
-				if (currentChunk->GetChunkCoordinates() == currentProxy.m_ChunkCoordinates)
-				{
-					desiredChunk = currentChunk;
-					break;
-				}
-			}
+		Chunk* desiredChunk = FindActiveChunkWithCoordinates(populatedRequest.m_ChunkCoordinates);
 
-			if (desiredChunk != nullptr)
+		if (populatedRequest.m_IsCancelled)
+		{
+			if (desiredChunk != nullptr && !desiredChunk->IsPopulated())
 			{
-				desiredChunk->PopulateChunkFromChunkProxy(currentProxy);
-				ConnectChunk(desiredChunk);
-				CalculateLightForChunk(desiredChunk);
+				DisconnectChunk(desiredChunk);
+				DestroyChunk(desiredChunk);
 			}
 		}
+		else if (desiredChunk != nullptr && !desiredChunk->IsPopulated())
+		{
+			desiredChunk->PopulateChunkFromChunkProxy(*populatedRequest.m_ChunkProxy);
+			ConnectChunk(desiredChunk);
+			m_LightingEngine.StitchLightAcrossChunkBorders(desiredChunk);
+		}
 
-		memset(g_LocalPopulatedChunkProxies, 0, proxyArraySize);
+		g_LoadQueueStatistics.RecordCompletedRequest(populatedRequest);
+		g_ChunkProxyPool.DeallocateChunkProxy(populatedRequest.m_ChunkProxy);
 	}
 }
 
 
 
-bool World::AddToSharedLoadedChunkProxies(const ChunkProxy& currentChunkProxy)
+void World::UpdateChunkMeshes()
 {
-	for (size_t chunkProxyIndex = 0; chunkProxyIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkProxyIndex)
-	{
-		ChunkProxy& currentProxy = g_SharedLoadedChunkProxies[chunkProxyIndex];
-		if (currentProxy.m_IsValid)
-		{
-			continue;
-		}
-
-		currentProxy = currentChunkProxy;
-		++g_NumberOfActivatedChunks;
-
-		return true;
-	}
+	double rebuildStartTime = GetCurrentTimeInSeconds();
+	double rebuildBudgetInSeconds = MESH_REBUILD_BUDGET_IN_MICROSECONDS * 0.000001;
 
-	return false;
+	UpdateMeshingMode();
+	UploadMeshedChunks(rebuildStartTime, rebuildBudgetInSeconds);
+	SubmitModifiedChunksForMeshing(rebuildStartTime, rebuildBudgetInSeconds);
 }
 
 
 
-bool World::AddToSharedSavedChunkProxies(const ChunkProxy& currentChunkProxy)
+void World::UpdateMeshingMode()
 {
-	for (size_t chunkProxyIndex = 0; chunkProxyIndex < MAXIMUM_NUMBER_OF_CHUNKS; ++chunkProxyIndex)
+	if (m_GreedyMeshingIsEnabled == g_GreedyMeshing)
 	{
-		ChunkProxy& currentProxy = g_SharedSavedChunkProxies[chunkProxyIndex];
-		if (currentProxy.m_IsValid)
-		{
-			continue;
-		}
+		return;
+	}
 
-		currentProxy = currentChunkProxy;
-		++g_NumberOfSavedChunks;
+	m_GreedyMeshingIsEnabled = g_GreedyMeshing;
+	m_NumberOfWarmUpRebuilds = 0U;
 
-		return true;
+	for (Chunk* currentChunk : m_AllChunks)
+	{
+		if (currentChunk != nullptr && currentChunk->IsPopulated())
+		{
+			currentChunk->SetModified(true);
+		}
 	}
-
-	return false;
 }
 
 
 
-Chunk* World::FindActiveChunkWithCoordinates(const IntVector2& chunkCoordinates) const
+void World::UpdateBlockStorageMode()
 {
+	if (m_PalettedBlockStorageIsEnabled == g_PalettedBlockStorage)
+	{
+		return;
+	}
+
+	m_PalettedBlockStorageIsEnabled = g_PalettedBlockStorage;
+
 	for (Chunk* currentChunk : m_AllChunks)
 	{
 		if (currentChunk != nullptr)
 		{
-			IntVector2 currentChunkCoordinates = currentChunk->GetChunkCoordinates();
-			if (currentChunkCoordinates == chunkCoordinates)
-			{
-				return currentChunk;
-			}
+			currentChunk->SetUsesPalettedBlockStorage(m_PalettedBlockStorageIsEnabled);
 		}
 	}
-
-	return nullptr;
 }
 
 
 
-void World::CalculateLightForChunk(Chunk* currentChunk)
+void World::UploadMeshedChunks(double rebuildStartTime, double rebuildBudgetInSeconds)
 {
-	for (int blockIndexY = 0; blockIndexY < NUMBER_OF_BLOCKS_Y; ++blockIndexY)
+	ChunkRequest poppedRequest;
+	while (g_MeshedChunkQueue.Pop(poppedRequest))
 	{
-		for (int blockIndexX = 0; blockIndexX < NUMBER_OF_BLOCKS_X; ++blockIndexX)
-		{
-			for (int blockIndexZ = NUMBER_OF_BLOCKS_Z - 1; blockIndexZ >= 0; --blockIndexZ)
-			{
-				IntVector3 localCoordinates = IntVector3(blockIndexX, blockIndexY, blockIndexZ);
+		m_DeferredMeshedRequests.push_back(poppedRequest);
+	}
 
-				int localIndex = currentChunk->GetLocalIndexForLocalCoordinates(localCoordinates);
+	size_t numberOfDeferredRequests = 0U;
 
-				if (currentChunk->m_Blocks[localIndex].IsOpaque())
-				{
-					break;
-				}
+	for (size_t meshedIndex = 0; meshedIndex < m_DeferredMeshedRequests.size(); ++meshedIndex)
+	{
+		ChunkRequest meshedRequest = m_DeferredMeshedRequests[meshedIndex];
 
-				currentChunk->m_Blocks[localIndex].SetSkyBit();
-				currentChunk->m_Blocks[localIndex].SetLightValue(SKY_LIGHT_VALUE);
-			}
+		bool budgetIsExhausted = (GetCurrentTimeInSeconds() - rebuildStartTime > rebuildBudgetInSeconds);
+		if (budgetIsExhausted && meshedRequest.m_Priority > URGENT_REBUILD_PRIORITY)
+		{
+			m_DeferredMeshedRequests[numberOfDeferredRequests++] = meshedRequest;
+			continue;
 		}
-	}
 
-	for (int blockIndexY = 0; blockIndexY < NUMBER_OF_BLOCKS_Y; ++blockIndexY)
-	{
-		for (int blockIndexX = 0; blockIndexX < NUMBER_OF_BLOCKS_X; ++blockIndexX)
-		{
-			for (int blockIndexZ = NUMBER_OF_BLOCKS_Z - 1; blockIndexZ >= 0; --blockIndexZ)
-			{
-				IntVector3 localCoordinates = IntVector3(blockIndexX, blockIndexY, blockIndexZ);
+		Chunk* meshedChunk = FindActiveChunkWithCoordinates(meshedRequest.m_ChunkCoordinates);
 
-				int localIndex = currentChunk->GetLocalIndexForLocalCoordinates(localCoordinates);
+		if (meshedChunk != nullptr && meshedChunk->GetMeshRevisionInFlight() == meshedRequest.m_MeshRevision)
+		{
+			const ChunkMeshSnapshot& meshSnapshot = *meshedRequest.m_MeshSnapshot;
 
-				if (currentChunk->m_Blocks[localIndex].IsOpaque())
-				{
-					break;
-				}
+			m_NumberOfChunkMeshVertices -= meshedChunk->GetNumberOfMeshVertices();
+			m_NumberOfChunkMeshIndices -= meshedChunk->GetNumberOfMeshIndices();
 
-				BlockInfo currentBlockInfo = BlockInfo(currentChunk, localIndex);
+			meshedChunk->WriteMeshFromSnapshot(meshSnapshot);
 
-				BlockInfo easternNeighbour = currentBlockInfo.GetEasternNeighbour();
-				if (easternNeighbour.GetChunk() != nullptr)
-				{
-					Block* easternBlock = easternNeighbour.GetBlock();
-					if (!easternBlock->IsOpaque())
-					{
-						if (!easternBlock->IsSky())
-						{
-							MarkLightingAsDirty(easternNeighbour);
-						}
-					}
-				}
+			m_NumberOfChunkMeshVertices += meshedChunk->GetNumberOfMeshVertices();
+			m_NumberOfChunkMeshIndices += meshedChunk->GetNumberOfMeshIndices();
 
-				BlockInfo westernNeighbour = currentBlockInfo.GetWesternNeighbour();
-				if (westernNeighbour.GetChunk() != nullptr)
-				{
-					Block* westernBlock = westernNeighbour.GetBlock();
-					if (!westernBlock->IsOpaque())
-					{
-						if (!westernBlock->IsSky())
-						{
-							MarkLightingAsDirty(westernNeighbour);
-						}
-					}
-				}
+			size_t numberOfWaterVertices = meshSnapshot.m_WaterVertices.size();
 
-				BlockInfo northernNeighbour = currentBlockInfo.GetNorthernNeighbour();
-				if (northernNeighbour.GetChunk() != nullptr)
-				{
-					Block* northernBlock = northernNeighbour.GetBlock();
-					if (!northernBlock->IsOpaque())
-					{
-						if (!northernBlock->IsSky())
-						{
-							MarkLightingAsDirty(northernNeighbour);
-						}
-					}
-				}
+			size_t uploadedVertexBytes = numberOfWaterVertices * sizeof(Vertex3D);
+			size_t uploadedIndexBytes = ChunkQuadIndexBuffer::GetNumberOfIndicesForVertices(numberOfWaterVertices) * sizeof(uint32_t);
 
-				BlockInfo southernNeighbour = currentBlockInfo.GetSouthernNeighbour();
-				if (southernNeighbour.GetChunk() != nullptr)
+			for (int sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+			{
+				if ((meshSnapshot.m_SectionsToBuild & (1U << sectionIndex)) != 0U)
 				{
-					Block* southernBlock = southernNeighbour.GetBlock();
-					if (!southernBlock->IsOpaque())
-					{
-						if (!southernBlock->IsSky())
-						{
-							MarkLightingAsDirty(southernNeighbour);
-						}
-					}
+					size_t numberOfSectionVertices = meshSnapshot.m_SectionVertices[sectionIndex].size();
+					uploadedVertexBytes += numberOfSectionVertices * sizeof(Vertex3D);
+					uploadedIndexBytes += ChunkQuadIndexBuffer::GetNumberOfIndicesForVertices(numberOfSectionVertices) * sizeof(uint32_t);
 				}
 			}
+
+			m_NumberOfUploadedMeshBytes += uploadedVertexBytes + uploadedIndexBytes;
+			meshedChunk->SetMeshRevisionInFlight(0U);
+			meshedChunk->SetSectionsInFlight(0U);
+
+			g_MeshQueueStatistics.RecordCompletedRequest(meshedRequest);
+			SampleScratchArenaGrowth();
+		}
+		else
+		{
+			g_MeshQueueStatistics.RecordCancelledRequest();
 		}
+
+		g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(meshedRequest.m_MeshSnapshot);
 	}
 
-	for (int blockIndexZ = 0; blockIndexZ < NUMBER_OF_BLOCKS_Z; ++blockIndexZ)
+	m_DeferredMeshedRequests.resize(numberOfDeferredRequests);
+}
+
+
+
+void World::SubmitModifiedChunksForMeshing(double rebuildStartTime, double rebuildBudgetInSeconds)
+{
+	m_ChunkRebuildQueue.clear();
+
+	for (Chunk* currentChunk : m_AllChunks)
 	{
-		for (int blockIndexY = 0; blockIndexY < NUMBER_OF_BLOCKS_Y; ++blockIndexY)
+		if (currentChunk == nullptr || !currentChunk->IsModified() || !currentChunk->IsPopulated())
 		{
-			for (int blockIndexX = 0; blockIndexX < NUMBER_OF_BLOCKS_X; ++blockIndexX)
-			{
-				IntVector3 localCoordinates = IntVector3(blockIndexX, blockIndexY, blockIndexZ);
+			continue;
+		}
 
-				int localIndex = currentChunk->GetLocalIndexForLocalCoordinates(localCoordinates);
+		if (currentChunk->MeshIsInFlight() && !currentChunk->NeedsUrgentRebuild())
+		{
+			continue;
+		}
 
-				int illuminationValue = currentChunk->m_Blocks[localIndex].GetInternalIlluminationValue();
+		m_ChunkRebuildQueue.push_back(ChunkRebuildCandidate(currentChunk, GetRebuildPriorityForChunk(currentChunk)));
+	}
 
-				BlockInfo currentBlockInfo = BlockInfo(currentChunk, localIndex);
+	std::sort(m_ChunkRebuildQueue.begin(), m_ChunkRebuildQueue.end());
 
-				if (illuminationValue > 0)
-				{
-					MarkLightingAsDirty(currentBlockInfo);
-				}
+	size_t numberOfSubmittedRebuilds = 0U;
+	for (const ChunkRebuildCandidate& rebuildCandidate : m_ChunkRebuildQueue)
+	{
+		bool rebuildIsUrgent = rebuildCandidate.m_Chunk->NeedsUrgentRebuild();
 
-				if (!currentBlockInfo.GetBlock()->IsOpaque())
-				{
-					if (currentBlockInfo.IsEdgeBlock())
-					{
-						MarkLightingAsDirty(currentBlockInfo);
-					}
-				}
+		if (!rebuildIsUrgent)
+		{
+			if (GetCurrentTimeInSeconds() - rebuildStartTime > rebuildBudgetInSeconds)
+			{
+				break;
+			}
+
+			if (g_ChunkMeshSnapshotPool.GetNumberOfFreeChunkMeshSnapshots() <= URGENT_MESH_SNAPSHOT_RESERVE)
+			{
+				break;
 			}
 		}
+
+		if (!SubmitChunkForMeshing(rebuildCandidate.m_Chunk, rebuildCandidate.m_Priority))
+		{
+			break;
+		}
+
+		++numberOfSubmittedRebuilds;
 	}
+
+	m_NumberOfPendingMeshRebuilds = m_ChunkRebuildQueue.size() - numberOfSubmittedRebuilds;
 }
 
 
 
-void World::MarkLightingAsDirty(BlockInfo currentBlockInfo)
+bool World::SubmitChunkForMeshing(Chunk* currentChunk, float meshPriority)
 {
-	Block* currentBlock = currentBlockInfo.GetBlock();
+	ChunkMeshSnapshot* meshSnapshot = g_ChunkMeshSnapshotPool.AllocateChunkMeshSnapshot();
+	if (meshSnapshot == nullptr)
+	{
+		return false;
+	}
 
-	if (currentBlock != nullptr)
+	uint8_t sectionsToBuild = currentChunk->GetModifiedSections();
+	if (currentChunk->MeshIsInFlight())
 	{
-		if (!currentBlock->LightingIsDirty())
-		{
-			m_DirtyBlocks.push_back(currentBlockInfo);
-			currentBlock->SetLightingDirty();
-		}
+		sectionsToBuild |= currentChunk->GetSectionsInFlight();
 	}
-}
 
+	currentChunk->PopulateMeshSnapshotFromChunk(*meshSnapshot);
+	meshSnapshot->m_UseGreedyMeshing = m_GreedyMeshingIsEnabled;
+	meshSnapshot->m_SectionsToBuild = sectionsToBuild;
 
+	++m_LatestMeshRevision;
+	if (m_LatestMeshRevision == 0U)
+	{
+		++m_LatestMeshRevision;
+	}
 
-int World::CalculateIdealLightForBlock(BlockInfo currentBlockInfo)
-{
-	Block* currentBlock = currentBlockInfo.GetBlock();
+	IntVector2 chunkCoordinates = currentChunk->GetChunkCoordinates();
 
-	int internalLightValue = currentBlock->GetInternalIlluminationValue();
-	if (currentBlock->IsOpaque())
+	bool addedSuccessfully = g_MeshRequestQueue.Push(ChunkRequest(chunkCoordinates, meshSnapshot, m_LatestMeshRevision, meshPriority));
+	g_MeshQueueStatistics.RecordQueueDepth(g_MeshRequestQueue.GetSize());
+
+	if (!addedSuccessfully)
 	{
-		return internalLightValue;
+		g_ChunkMeshSnapshotPool.DeallocateChunkMeshSnapshot(meshSnapshot);
+		return false;
 	}
 
-	int neighbourPropagatedLightValue = GetPropagatedLightFromNeighbour(currentBlockInfo);
-	int skyLightValue = currentBlock->IsSky() ? SKY_LIGHT_VALUE : 0;
+	currentChunk->SetMeshRevisionInFlight(m_LatestMeshRevision);
+	currentChunk->SetSectionsInFlight(sectionsToBuild);
+	currentChunk->SetModified(false);
+	currentChunk->SetNeedsUrgentRebuild(false);
 
-	return GetMaximumOfThreeInts(internalLightValue, neighbourPropagatedLightValue, skyLightValue);
+	g_ChunkWorkerPool.SignalWorkIsAvailable();
+
+	return true;
 }
 
 
 
-int World::GetPropagatedLightFromNeighbour(BlockInfo currentBlockInfo)
+void World::SampleScratchArenaGrowth()
 {
-	int neededPropagatedLight = 0;
-	int idealPropogatedLight;
+	size_t numberOfScratchAllocations = ChunkMeshScratchArena::GetNumberOfAllocations();
 
-	int currentPropogatedLight = neededPropagatedLight;
-
-	BlockInfo easternNeighbour = currentBlockInfo.GetEasternNeighbour();
-	if (easternNeighbour.GetChunk() != nullptr)
+	if (m_NumberOfWarmUpRebuilds < SCRATCH_ARENA_WARM_UP_REBUILDS)
 	{
-		currentPropogatedLight = easternNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
+		++m_NumberOfWarmUpRebuilds;
 	}
-
-	BlockInfo westernNeighbour = currentBlockInfo.GetWesternNeighbour();
-	if (westernNeighbour.GetChunk() != nullptr)
+	else if (numberOfScratchAllocations != m_PreviousScratchAllocations)
 	{
-		currentPropogatedLight = westernNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
+		++m_NumberOfScratchArenaGrowths;
 	}
 
-	BlockInfo northernNeighbour = currentBlockInfo.GetNorthernNeighbour();
-	if (northernNeighbour.GetChunk() != nullptr)
-	{
-		currentPropogatedLight = northernNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
-	}
+	m_PreviousScratchAllocations = numberOfScratchAllocations;
+}
+
 
-	BlockInfo southernNeighbour = currentBlockInfo.GetSouthernNeighbour();
-	if (southernNeighbour.GetChunk() != nullptr)
-	{
-		currentPropogatedLight = southernNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
-	}
 
-	BlockInfo aboveNeighbour = currentBlockInfo.GetAboveNeighbour();
-	if (aboveNeighbour.GetChunk() != nullptr)
+float World::GetRebuildPriorityForChunk(Chunk* currentChunk)
+{
+	if (currentChunk->NeedsUrgentRebuild())
 	{
-		currentPropogatedLight = aboveNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
+		return URGENT_REBUILD_PRIORITY;
 	}
 
-	BlockInfo belowNeighbour = currentBlockInfo.GetBelowNeighbour();
-	if (belowNeighbour.GetChunk() != nullptr)
+	float rebuildPriority = GetSquaredDistanceToNearestPlayer(currentChunk->GetChunkCoordinates());
+
+	Vector3 chunkWorldMinimums = currentChunk->GetChunkWorldMinimums();
+	bool chunkIsInView = ChunkIsInViewOfCamera(g_TheGame->m_PlayerOneCamera, chunkWorldMinimums);
+
+	if (!chunkIsInView && g_TwoPlayerMode)
 	{
-		currentPropogatedLight = belowNeighbour.GetBlock()->GetLightValue();
-		idealPropogatedLight = currentPropogatedLight - 1;
-		neededPropagatedLight = GetMaximumOfTwoInts(idealPropogatedLight, neededPropagatedLight);
+		chunkIsInView = ChunkIsInViewOfCamera(g_TheGame->m_PlayerTwoCamera, chunkWorldMinimums);
 	}
 
-	if (neededPropagatedLight < 0)
+	if (!chunkIsInView)
 	{
-		neededPropagatedLight = 0;
+		rebuildPriority *= OFF_SCREEN_REBUILD_PRIORITY_SCALE;
 	}
 
-	return neededPropagatedLight;
+	return rebuildPriority;
 }
 
 
 
-void World::UpdateLighting()
+float World::GetSquaredDistanceToNearestPlayer(const IntVector2& chunkCoordinates)
 {
-	while (!m_DirtyBlocks.empty())
+	Vector2 chunkCentre = GetChunkWorldCentreForChunkCoordinates(chunkCoordinates);
+
+	Vector2 playerOnePositionXY = Vector2(m_PlayerOne->m_Position.X, m_PlayerOne->m_Position.Y);
+	float squaredDistanceToNearestPlayer = CalculateEuclidianSquaredDistanceIn2D(playerOnePositionXY, chunkCentre);
+
+	if (g_TwoPlayerMode)
 	{
-		BlockInfo dirtyBlockInfo = m_DirtyBlocks.front();
-		m_DirtyBlocks.pop_front();
-		dirtyBlockInfo.GetBlock()->ClearLightingDirty();
-		UpdateLightForBlock(dirtyBlockInfo);
+		Vector2 playerTwoPositionXY = Vector2(m_PlayerTwo->m_Position.X, m_PlayerTwo->m_Position.Y);
+		float playerTwoSquaredDistance = CalculateEuclidianSquaredDistanceIn2D(playerTwoPositionXY, chunkCentre);
+
+		if (playerTwoSquaredDistance < squaredDistanceToNearestPlayer)
+		{
+			squaredDistanceToNearestPlayer = playerTwoSquaredDistance;
+		}
 	}
+
+	return squaredDistanceToNearestPlayer;
 }
 
 
 
-void World::UpdateLightForBlock(BlockInfo currentBlockInfo)
+Chunk* World::FindActiveChunkWithCoordinates(const IntVector2& chunkCoordinates) const
 {
-	int idealLightValue = CalculateIdealLightForBlock(currentBlockInfo);
-	int currentLightValue = currentBlockInfo.GetBlock()->GetLightValue();
-
-	if (idealLightValue != currentLightValue)
-	{
-		currentBlockInfo.GetBlock()->SetLightValue(idealLightValue);
-		DirtyNeighboursOnLightChange(currentBlockInfo);
-		currentBlockInfo.GetChunk()->SetModified(true);
-	}
-
-	ModifyNeighbourChunksForEdgeBlocks(currentBlockInfo);
+	return m_ActiveChunkMap.FindChunk(chunkCoordinates);
 }
 
 
 
-void World::DirtyNeighboursOnLightChange(BlockInfo currentBlockInfo)
+void World::UpdateLighting()
 {
-	BlockInfo easternNeighbour = currentBlockInfo.GetEasternNeighbour();
-	if (easternNeighbour.GetChunk() != nullptr)
-	{
-		Block* easternBlock = easternNeighbour.GetBlock();
-		if (!easternBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(easternNeighbour);
-		}
-	}
+	IntVector2 playerChunkCoordinates[NUMBER_OF_PLAYERS];
+	size_t numberOfPlayers = (g_TwoPlayerMode) ? 2U : 1U;
 
-	BlockInfo westernNeighbour = currentBlockInfo.GetWesternNeighbour();
-	if (westernNeighbour.GetChunk() != nullptr)
+	playerChunkCoordinates[PLAYER_ONE] = GetChunkCoordinatesForPlayerPosition(PLAYER_ONE);
+	if (g_TwoPlayerMode)
 	{
-		Block* westernBlock = westernNeighbour.GetBlock();
-		if (!westernBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(westernNeighbour);
-		}
+		playerChunkCoordinates[PLAYER_TWO] = GetChunkCoordinatesForPlayerPosition(PLAYER_TWO);
 	}
 
-	BlockInfo northernNeighbour = currentBlockInfo.GetNorthernNeighbour();
-	if (northernNeighbour.GetChunk() != nullptr)
-	{
-		Block* northernBlock = northernNeighbour.GetBlock();
-		if (!northernBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(northernNeighbour);
-		}
-	}
+	m_LightingEngine.SetPriorityChunkCoordinates(playerChunkCoordinates, numberOfPlayers);
 
-	BlockInfo southernNeighbour = currentBlockInfo.GetSouthernNeighbour();
-	if (southernNeighbour.GetChunk() != nullptr)
-	{
-		Block* southernBlock = southernNeighbour.GetBlock();
-		if (!southernBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(southernNeighbour);
-		}
-	}
+	double lightingBudgetInSeconds = LIGHTING_BUDGET_IN_MICROSECONDS * 0.000001;
+	m_LightingEngine.PropagateLightChanges(lightingBudgetInSeconds, MAXIMUM_LIGHT_UPDATES_PER_FRAME);
 
-	BlockInfo aboveNeighbour = currentBlockInfo.GetAboveNeighbour();
-	if (aboveNeighbour.GetChunk() != nullptr)
+	VerifyLightingAroundLatestEdit();
+}
+
+
+
+void World::VerifyLightingAroundLatestEdit()
+{
+	if (!g_DebugMode || !m_LightingNeedsVerification || m_LightingEngine.GetNumberOfPendingLightChanges() > 0U)
 	{
-		Block* aboveBlock = aboveNeighbour.GetBlock();
-		if (!aboveBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(aboveNeighbour);
-		}
+		return;
 	}
 
-	BlockInfo belowNeighbour = currentBlockInfo.GetBelowNeighbour();
-	if (belowNeighbour.GetChunk() != nullptr)
+	m_LightingNeedsVerification = false;
+
+	Chunk* editedChunk = FindActiveChunkWithCoordinates(m_LatestEditedChunkCoordinates);
+	if (editedChunk != nullptr)
 	{
-		Block* belowBlock = belowNeighbour.GetBlock();
-		if (!belowBlock->IsOpaque())
-		{
-			MarkLightingAsDirty(belowNeighbour);
-		}
+		m_LightingEngine.VerifyChunkGroupAgainstRelaxation(editedChunk);
 	}
 }
 
@@ -2104,8 +2714,7 @@ void World::PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerN
 	BlockInfo previousBlockInfo = raycastResult.m_previousBlockInfo;
 	BlockInfo currentBlockInfo = raycastResult.m_currentBlockInfo;
 
-	Block* previousBlock = previousBlockInfo.GetBlock();
-	Block* currentBlock = currentBlockInfo.GetBlock();
+	Block currentBlock = currentBlockInfo.GetBlock();
 
 	bool blockCanBePlaced = false;
 
@@ -2119,7 +2728,7 @@ void World::PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerN
 		size_t numberOfOverlappingPlayerTwoBlocks = 0U;
 		GetPlayerOverlappingBlocks(m_PlayerTwo, playerTwoOverlappingBlocks, numberOfOverlappingPlayerTwoBlocks);
 
-		if (currentBlock->GetType() != WATER_BLOCK)
+		if (currentBlock.GetType() != WATER_BLOCK)
 		{
 			blockCanBePlaced =	!PlayerOverlapsSelectedBlock(previousBlockInfo, playerOneOverlappingBlocks, numberOfOverlappingPlayerOneBlocks) &&
 								!PlayerOverlapsSelectedBlock(previousBlockInfo, playerTwoOverlappingBlocks, numberOfOverlappingPlayerTwoBlocks);
@@ -2132,7 +2741,7 @@ void World::PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerN
 	}
 	else
 	{
-		if (currentBlock->GetType() != WATER_BLOCK)
+		if (currentBlock.GetType() != WATER_BLOCK)
 		{
 			blockCanBePlaced = !PlayerOverlapsSelectedBlock(previousBlockInfo, playerOneOverlappingBlocks, numberOfOverlappingPlayerOneBlocks);
 		}
@@ -2144,30 +2753,34 @@ void World::PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerN
 
 	if (InputSystem::SingletonInstance()->ButtonWasJustPressed(controllerNumber, RIGHT_BUMPER))
 	{
-		if (currentBlock->GetType() != WATER_BLOCK)
+		if (currentBlock.GetType() != WATER_BLOCK)
 		{
 			if (blockCanBePlaced)
 			{
-				RecalculateLightUponPlacing(previousBlockInfo);
-				previousBlock->SetType(selectedBlock);
 				Chunk* previousBlockChunk = previousBlockInfo.GetChunk();
-				previousBlockChunk->SetModified(true);
+				int previousColumnHeight = previousBlockChunk->GetColumnHeight(previousBlockChunk->GetColumnIndexForLocalIndex(previousBlockInfo.GetBlockIndex()));
+				previousBlockInfo.SetBlockType(selectedBlock);
+				previousBlockChunk->MarkBlockTypeAsChanged(previousBlockInfo.GetBlockIndex());
+				RelightColumnFromBlock(previousBlockInfo, previousColumnHeight);
+				previousBlockChunk->SetNeedsUrgentRebuild(true);
 				ModifyNeighbourChunksForEdgeBlocks(previousBlockInfo);
 
-				AudioSystem::SingletonInstance()->PlaySound(previousBlock->GetPlacingSound(), FORWARD_PLAYBACK_MODE);
+				AudioSystem::SingletonInstance()->PlaySound(previousBlockInfo.GetBlock().GetPlacingSound(), FORWARD_PLAYBACK_MODE);
 			}
 		}
 		else
 		{
 			if (blockCanBePlaced)
 			{
-				RecalculateLightUponPlacing(currentBlockInfo);
-				currentBlock->SetType(selectedBlock);
 				Chunk* currentBlockChunk = currentBlockInfo.GetChunk();
-				currentBlockChunk->SetModified(true);
+				int previousColumnHeight = currentBlockChunk->GetColumnHeight(currentBlockChunk->GetColumnIndexForLocalIndex(currentBlockInfo.GetBlockIndex()));
+				currentBlockInfo.SetBlockType(selectedBlock);
+				currentBlockChunk->MarkBlockTypeAsChanged(currentBlockInfo.GetBlockIndex());
+				RelightColumnFromBlock(currentBlockInfo, previousColumnHeight);
+				currentBlockChunk->SetNeedsUrgentRebuild(true);
 				ModifyNeighbourChunksForEdgeBlocks(currentBlockInfo);
 
-				AudioSystem::SingletonInstance()->PlaySound(currentBlock->GetPlacingSound(), FORWARD_PLAYBACK_MODE);
+				AudioSystem::SingletonInstance()->PlaySound(currentBlockInfo.GetBlock().GetPlacingSound(), FORWARD_PLAYBACK_MODE);
 			}
 		}
 	}
@@ -2178,36 +2791,39 @@ void World::PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerN
 void World::DigBlock(const RaycastResult3D& raycastResult, uint8_t controllerNumber)
 {
 	BlockInfo currentBlockInfo = raycastResult.m_currentBlockInfo;
-	Block* currentBlock = currentBlockInfo.GetBlock();
+	Block currentBlock = currentBlockInfo.GetBlock();
 
 	if (InputSystem::SingletonInstance()->ButtonWasJustPressed(controllerNumber, LEFT_BUMPER))
 	{
-		AudioSystem::SingletonInstance()->PlaySound(currentBlock->GetBreakingSound(), FORWARD_PLAYBACK_MODE);
+		AudioSystem::SingletonInstance()->PlaySound(currentBlock.GetBreakingSound(), FORWARD_PLAYBACK_MODE);
 
-		if (currentBlock->GetType() != WATER_BLOCK && currentBlock->GetType() != BEDROCK_BLOCK)
+		if (currentBlock.GetType() != WATER_BLOCK && currentBlock.GetType() != BEDROCK_BLOCK)
 		{
-			Block* easternNeighbourBlock = currentBlockInfo.GetEasternNeighbour().GetBlock();
-			Block* westernNeighbourBlock = currentBlockInfo.GetWesternNeighbour().GetBlock();
-			Block* northernNeighbourBlock = currentBlockInfo.GetNorthernNeighbour().GetBlock();
-			Block* southernNeighbourBlock = currentBlockInfo.GetSouthernNeighbour().GetBlock();
-			Block* aboveNeighbourBlock = currentBlockInfo.GetAboveNeighbour().GetBlock();
+			Block easternNeighbourBlock = currentBlockInfo.GetEasternNeighbour().GetBlock();
+			Block westernNeighbourBlock = currentBlockInfo.GetWesternNeighbour().GetBlock();
+			Block northernNeighbourBlock = currentBlockInfo.GetNorthernNeighbour().GetBlock();
+			Block southernNeighbourBlock = currentBlockInfo.GetSouthernNeighbour().GetBlock();
+			Block aboveNeighbourBlock = currentBlockInfo.GetAboveNeighbour().GetBlock();
+
+			Chunk* currentBlockChunk = currentBlockInfo.GetChunk();
+			int previousColumnHeight = currentBlockChunk->GetColumnHeight(currentBlockChunk->GetColumnIndexForLocalIndex(currentBlockInfo.GetBlockIndex()));
 
-			if (easternNeighbourBlock->GetType() != WATER_BLOCK &&
-				westernNeighbourBlock->GetType() != WATER_BLOCK &&
-				northernNeighbourBlock->GetType() != WATER_BLOCK &&
-				southernNeighbourBlock->GetType() != WATER_BLOCK &&
-				aboveNeighbourBlock->GetType() != WATER_BLOCK)
+			if (easternNeighbourBlock.GetType() != WATER_BLOCK &&
+				westernNeighbourBlock.GetType() != WATER_BLOCK &&
+				northernNeighbourBlock.GetType() != WATER_BLOCK &&
+				southernNeighbourBlock.GetType() != WATER_BLOCK &&
+				aboveNeighbourBlock.GetType() != WATER_BLOCK)
 			{
-				currentBlock->SetType(AIR_BLOCK);
+				currentBlockInfo.SetBlockType(AIR_BLOCK);
 			}
 			else
 			{
-				currentBlock->SetType(WATER_BLOCK);
+				currentBlockInfo.SetBlockType(WATER_BLOCK);
 			}
 
-			RecalculateLightUponDigging(currentBlockInfo);
-			Chunk* currentBlockChunk = currentBlockInfo.GetChunk();
-			currentBlockChunk->SetModified(true);
+			currentBlockChunk->MarkBlockTypeAsChanged(currentBlockInfo.GetBlockIndex());
+			RelightColumnFromBlock(currentBlockInfo, previousColumnHeight);
+			currentBlockChunk->SetNeedsUrgentRebuild(true);
 
 			ModifyNeighbourChunksForEdgeBlocks(currentBlockInfo);
 		}
@@ -2219,90 +2835,50 @@ void World::DigBlock(const RaycastResult3D& raycastResult, uint8_t controllerNum
 void World::ModifyNeighbourChunksForEdgeBlocks(BlockInfo currentBlockInfo)
 {
 	Chunk* currentChunk = currentBlockInfo.GetChunk();
+	int currentBlockIndex = currentBlockInfo.GetBlockIndex();
 
 	if (currentBlockInfo.IsEasternEdgeBlock())
 	{
 		if (currentChunk->m_EasternNeighbour != nullptr)
 		{
-			currentChunk->m_EasternNeighbour->SetModified(true);
+			currentChunk->m_EasternNeighbour->MarkSectionsModifiedForLocalIndex(currentBlockIndex);
+			currentChunk->m_EasternNeighbour->SetNeedsUrgentRebuild(true);
 		}
 	}
 	if (currentBlockInfo.IsWesternEdgeBlock())
 	{
 		if (currentChunk->m_WesternNeighbour != nullptr)
 		{
-			currentChunk->m_WesternNeighbour->SetModified(true);
+			currentChunk->m_WesternNeighbour->MarkSectionsModifiedForLocalIndex(currentBlockIndex);
+			currentChunk->m_WesternNeighbour->SetNeedsUrgentRebuild(true);
 		}
 	}
 	if (currentBlockInfo.IsNorthernEdgeBlock())
 	{
 		if (currentChunk->m_NorthernNeighbour != nullptr)
 		{
-			currentChunk->m_NorthernNeighbour->SetModified(true);
+			currentChunk->m_NorthernNeighbour->MarkSectionsModifiedForLocalIndex(currentBlockIndex);
+			currentChunk->m_NorthernNeighbour->SetNeedsUrgentRebuild(true);
 		}
 	}
 	if (currentBlockInfo.IsSouthernEdgeBlock())
 	{
 		if (currentChunk->m_SouthernNeighbour != nullptr)
 		{
-			currentChunk->m_SouthernNeighbour->SetModified(true);
-		}
-	}
-}
-
-
-
-void World::RecalculateLightUponPlacing(BlockInfo currentBlockInfo)
-{
-	Block* currentBlock = currentBlockInfo.GetBlock();
-
-	if (currentBlock->IsSky())
-	{
-		Chunk* currentChunk = currentBlockInfo.GetChunk();
-		int currentBlockIndex = currentBlockInfo.GetBlockIndex();
-		int newBlockIndex = currentBlockIndex;
-
-		while (!currentChunk->m_Blocks[newBlockIndex].IsOpaque())
-		{
-			currentChunk->m_Blocks[newBlockIndex].ClearSkyBit();
-			BlockInfo newBlockInfo = BlockInfo(currentChunk, newBlockIndex);
-			MarkLightingAsDirty(newBlockInfo);
-
-			newBlockIndex -= NUMBER_OF_BLOCKS_PER_LAYER;
+			currentChunk->m_SouthernNeighbour->MarkSectionsModifiedForLocalIndex(currentBlockIndex);
+			currentChunk->m_SouthernNeighbour->SetNeedsUrgentRebuild(true);
 		}
 	}
-	else
-	{
-		MarkLightingAsDirty(currentBlockInfo);
-	}
 }
 
 
 
-void World::RecalculateLightUponDigging(BlockInfo currentBlockInfo)
+void World::RelightColumnFromBlock(BlockInfo currentBlockInfo, int previousColumnHeight)
 {
-	BlockInfo aboveNeighbourInfo = currentBlockInfo.GetAboveNeighbour();
-	Block* aboveNeighbourBlock = aboveNeighbourInfo.GetBlock();
-
-	if (aboveNeighbourBlock->IsSky())
-	{
-		Chunk* currentChunk = currentBlockInfo.GetChunk();
-		int currentBlockIndex = currentBlockInfo.GetBlockIndex();
-		int newBlockIndex = currentBlockIndex;
-
-		while (!currentChunk->m_Blocks[newBlockIndex].IsOpaque())
-		{
-			currentChunk->m_Blocks[newBlockIndex].SetSkyBit();
-			BlockInfo newBlockInfo = BlockInfo(currentChunk, newBlockIndex);
-			MarkLightingAsDirty(newBlockInfo);
+	m_LatestEditedChunkCoordinates = currentBlockInfo.GetChunk()->GetChunkCoordinates();
+	m_LightingNeedsVerification = true;
 
-			newBlockIndex -= NUMBER_OF_BLOCKS_PER_LAYER;
-		}
-	}
-	else
-	{
-		MarkLightingAsDirty(currentBlockInfo);
-	}
+	m_LightingEngine.MarkColumnForRelighting(currentBlockInfo, previousColumnHeight);
 }
 
 
@@ -2396,41 +2972,29 @@ bool World::PlayerIsOnTheGround(Player* currentPlayer)
 	northEastPoint.Z -= 0.01f;
 	northWestPoint.Z -= 0.01f;
 
-	Block* southWestFloorBlock = GetBlockForWorldCoordinates(southWestPoint);
-	Block* southEastFloorBlock = GetBlockForWorldCoordinates(southEastPoint);
-	Block* northEastFloorBlock = GetBlockForWorldCoordinates(northEastPoint);
-	Block* northWestFloorBlock = GetBlockForWorldCoordinates(northWestPoint);
+	Block southWestFloorBlock = GetBlockForWorldCoordinates(southWestPoint);
+	Block southEastFloorBlock = GetBlockForWorldCoordinates(southEastPoint);
+	Block northEastFloorBlock = GetBlockForWorldCoordinates(northEastPoint);
+	Block northWestFloorBlock = GetBlockForWorldCoordinates(northWestPoint);
 
-	if (southWestFloorBlock != nullptr)
+	if (southWestFloorBlock.IsSolid())
 	{
-		if (southWestFloorBlock->IsSolid())
-		{
-			return true;
-		}
+		return true;
 	}
 
-	if (southEastFloorBlock != nullptr)
+	if (southEastFloorBlock.IsSolid())
 	{
-		if (southEastFloorBlock->IsSolid())
-		{
-			return true;
-		}
+		return true;
 	}
 
-	if (northEastFloorBlock != nullptr)
+	if (northEastFloorBlock.IsSolid())
 	{
-		if (northEastFloorBlock->IsSolid())
-		{
-			return true;
-		}
+		return true;
 	}
 
-	if (northWestFloorBlock != nullptr)
+	if (northWestFloorBlock.IsSolid())
 	{
-		if (northWestFloorBlock->IsSolid())
-		{
-			return true;
-		}
+		return true;
 	}
 
 	return false;
@@ -2527,7 +3091,7 @@ void World::ApplyCorrectivePhysics(Player* currentPlayer)
 		BlockInfo currentOverlappingBlock = overlappingBlocks[blockIndex];
 		if (currentOverlappingBlock.GetChunk() != nullptr)
 		{
-			if (currentOverlappingBlock.GetBlock()->IsSolid())
+			if (currentOverlappingBlock.GetBlock().IsSolid())
 			{
 				AABB3 blockBoundingBox = GetBoundingBoxForBlockInfo(currentOverlappingBlock);
 				if (DoAABB3sIntersect(playerBounds, blockBoundingBox))
@@ -3007,7 +3571,7 @@ BlockInfo World::GetBlockInfoForWorldCoordinates(const Vector3& blockWorldCoordi
 
 
 
-Block* World::GetBlockForWorldCoordinates(const Vector3& blockWorldCoordinates)
+Block World::GetBlockForWorldCoordinates(const Vector3& blockWorldCoordinates)
 {
 	BlockInfo currentBlockInfo = GetBlockInfoForWorldCoordinates(blockWorldCoordinates);
 
@@ -3018,23 +3582,21 @@ Block* World::GetBlockForWorldCoordinates(const Vector3& blockWorldCoordinates)
 
 float World::GetColumnHeightForWorldXYCoordinates(const Vector2& worldXYCoordinates)
 {
-	for (int heightIndex = NUMBER_OF_BLOCKS_Z - 1; heightIndex >= 0; --heightIndex)
-	{
-		float worldHeight = static_cast<float>(heightIndex);
+	BlockInfo columnBlockInfo = GetBlockInfoForWorldCoordinates(Vector3(worldXYCoordinates.X, worldXYCoordinates.Y, 0.0f));
 
-		BlockInfo currentBlockInfo = GetBlockInfoForWorldCoordinates(Vector3(worldXYCoordinates.X, worldXYCoordinates.Y, worldHeight));
-		Block* currentBlock = currentBlockInfo.GetBlock();
+	Chunk* columnChunk = columnBlockInfo.GetChunk();
+	if (columnChunk == nullptr)
+	{
+		return 0.0f;
+	}
 
-		if (currentBlock != nullptr)
-		{
-			if (currentBlock->IsSolid())
-			{
-				return worldHeight;
-			}
-		}
+	int columnHeight = columnChunk->GetColumnHeight(columnChunk->GetColumnIndexForLocalIndex(columnBlockInfo.GetBlockIndex()));
+	if (columnHeight == 0)
+	{
+		return 0.0f;
 	}
 
-	return 0.0f;
+	return static_cast<float>(columnHeight - 1);
 }
 
 
@@ -3059,7 +3621,7 @@ void World::GetPlayerOverlappingBlocks(Player* currentPlayer, BlockInfo* overlap
 		Vector3 currentBoundingPoint = playerBoundingPoints[boundingPointIndex];
 		BlockInfo currentOverlappingBlock = GetBlockInfoForWorldCoordinates(currentBoundingPoint);
 
-		if (currentOverlappingBlock.GetBlock() != nullptr)
+		if (currentOverlappingBlock.GetChunk() != nullptr)
 		{
 			overlappingBlocks[numberOfOverlappingBlocks] = currentOverlappingBlock;
 			++numberOfOverlappingBlocks;
@@ -3210,7 +3772,11 @@ void World::UpdatePlayerAngleToSun(float deltaTimeInSeconds)
 		interpolationFactor = (m_PlayerAngleToSun - 270.0f) / 90.0f;
 	}
 
-	m_AllWorldLights[2]->SetLightColor(LinearlyInterpolateIn3D(initialColor, finalColor, interpolationFactor));
+	Vector3 sunColor = LinearlyInterpolateIn3D(initialColor, finalColor, interpolationFactor);
+	m_AllWorldLights[2]->SetLightColor(sunColor);
+
+	float sunIntensity = (sunColor.X + sunColor.Y + sunColor.Z) / 3.0f;
+	m_SkyLightIntensity = GetMaximumOfTwoFloats(sunIntensity, MINIMUM_SKY_LIGHT_INTENSITY);
 }
 
 
@@ -3306,4 +3872,5 @@ void World::SetLightDataToShaderProgram(const Camera3D* playerCamera) const
 	float specularPower = 32.0f;
 	m_ChunkMaterial->SetFloatToShaderProgram1D("g_SpecularPower", (float*)&specularPower);
 	m_ChunkMaterial->SetFloatToShaderProgram3D("g_CameraPosition", (float*)&playerCamera->m_Position);
+	m_ChunkMaterial->SetFloatToShaderProgram1D("g_SkyLightIntensity", (float*)&m_SkyLightIntensity);
 }
\ No newline at end of file
@@ -2,7 +2,13 @@
 
 #include "Game/GameCommons.hpp"
 #include "Game/Chunk.hpp"
+#include "Game/ActiveChunkMap.hpp"
+#include "Game/ChunkQueue.hpp"
+#include "Game/ChunkProxyPool.hpp"
+#include "Game/ChunkMeshSnapshotPool.hpp"
+#include "Game/ChunkWorkerPool.hpp"
 #include "Game/BlockInfo.hpp"
+#include "Game/LightingEngine.hpp"
 #include "Game/Player.hpp"
 #include "Game/Enemy.hpp"
 #include "Game/Bullet.hpp"
@@ -42,6 +48,33 @@ struct RaycastResult3D
 
 
 
+struct ChunkRebuildCandidate
+{
+	Chunk* m_Chunk;
+	float m_Priority;
+
+	ChunkRebuildCandidate() :
+	m_Chunk(nullptr),
+	m_Priority(0.0f)
+	{
+
+	}
+
+	ChunkRebuildCandidate(Chunk* currentChunk, float priority) :
+	m_Chunk(currentChunk),
+	m_Priority(priority)
+	{
+
+	}
+
+	bool operator<(const ChunkRebuildCandidate& otherCandidate) const
+	{
+		return m_Priority < otherCandidate.m_Priority;
+	}
+};
+
+
+
 class World
 {
 public:
@@ -59,6 +92,29 @@ public:
 	void RenderSkyboxFromCamera(const Camera3D* playerCamera) const;
 	void RenderAllEntities() const;
 
+	const ChunkQueueStatistics& GetLoadQueueStatistics() const;
+	const ChunkQueueStatistics& GetPopulatedQueueStatistics() const;
+	const ChunkQueueStatistics& GetSaveQueueStatistics() const;
+	const ChunkQueueStatistics& GetMeshQueueStatistics() const;
+	const ChunkWorkerPool& GetChunkWorkerPool() const;
+	const ChunkProxyPool& GetChunkProxyPool() const;
+	size_t GetNumberOfPendingMeshRebuilds() const;
+	size_t GetNumberOfPendingLightUpdates() const;
+	size_t GetNumberOfProcessedLightUpdates() const;
+	size_t GetNumberOfChunkMeshVertices() const;
+	size_t GetNumberOfChunkMeshIndices() const;
+	uint64_t GetNumberOfUploadedMeshBytes() const;
+	size_t GetNumberOfScratchArenaGrowths() const;
+	size_t GetNumberOfBlockTypeBytes() const;
+	size_t GetNumberOfBenchmarkedChunks() const;
+	double GetPerBlockVisibilityMilliseconds() const;
+	double GetRowMaskVisibilityMilliseconds() const;
+	size_t GetNumberOfComparedLightingEdits() const;
+	size_t GetNumberOfLightingMismatches() const;
+
+	void BenchmarkFaceVisibility();
+	void CompareLightingAgainstRelaxation();
+
 private:
 	void OnePlayerUpdateCall(float deltaTimeInSeconds);
 	void TwoPlayerUpdateCall(float deltaTimeInSeconds);
@@ -66,8 +122,11 @@ private:
 	void OnePlayerRenderCall() const;
 	void TwoPlayerRenderCall() const;
 
-	static void ProcessChunkManagement(void*);
-	void UpdateChunkManagement();
+	static void ProcessChunkManagement(void* workerData);
+	void FinishRemainingChunkJobs();
+	static void LoadChunkProxy(ChunkProxy* currentChunkProxy, uint8_t* rleBuffer);
+	static void SaveChunkProxy(ChunkProxy* currentChunkProxy, uint8_t* rleBuffer);
+	void UpdateChunkManagement(float deltaTimeInSeconds);
 	void UpdateBlockManagement(Player* currentPlayer, uint8_t currentPlayerID, RaycastResult3D& raycastResult);
 
 	void UpdateAllEnemies(float deltaTimeInSeconds);
@@ -90,8 +149,13 @@ private:
 	Chunk* CreateChunk(const IntVector2& chunkCoordinates);
 	void DestroyChunk(Chunk* currentChunk);
 
-	void ActivateNearestMissingChunk();
-	bool FindNearestMissingChunk(IntVector2& chunkCoordinates, float& lowestPossibleSquaredDistance, const Player* currentPlayer);
+	void GenerateChunkActivationOffsets(int activationRadius);
+	void UpdateStreamingVelocities(float deltaTimeInSeconds);
+	IntVector2 GetPrefetchChunkCoordinatesForPlayer(const Player* currentPlayer, uint8_t currentPlayerID) const;
+	float GetStreamingPriorityForChunkOffset(size_t activationIndex, const Vector2& viewDirection, const Vector2& movementDirection) const;
+	void ActivateNearestMissingChunks();
+	bool FindNearestMissingChunk(IntVector2& chunkCoordinates, float& highestPossiblePriority, const Player* currentPlayer, uint8_t currentPlayerID);
+	bool ActivateChunk(const IntVector2& chunkCoordinates, float loadPriority);
 	void ConnectChunk(Chunk* currentChunk);
 
 	void DeactivateFarthestChunk();
@@ -100,29 +164,28 @@ private:
 
 	void PopulateLoadedChunks();
 
-	bool AddToSharedLoadedChunkProxies(const ChunkProxy& currentChunkProxy);
-	bool AddToSharedSavedChunkProxies(const ChunkProxy& currentChunkProxy);
+	void UpdateChunkMeshes();
+	void UpdateMeshingMode();
+	void UpdateBlockStorageMode();
+	void UploadMeshedChunks(double rebuildStartTime, double rebuildBudgetInSeconds);
+	void SubmitModifiedChunksForMeshing(double rebuildStartTime, double rebuildBudgetInSeconds);
+	bool SubmitChunkForMeshing(Chunk* currentChunk, float meshPriority);
+	void SampleScratchArenaGrowth();
+	float GetRebuildPriorityForChunk(Chunk* currentChunk);
+	float GetSquaredDistanceToNearestPlayer(const IntVector2& chunkCoordinates);
 
 	Chunk* FindActiveChunkWithCoordinates(const IntVector2& chunkCoordinates) const;
 
-	void CalculateLightForChunk(Chunk* currentChunk);
-	void MarkLightingAsDirty(BlockInfo currentBlockInfo);
-
-	int CalculateIdealLightForBlock(BlockInfo currentBlockInfo);
-	int GetPropagatedLightFromNeighbour(BlockInfo currentBlockInfo);
-
 	void UpdateLighting();
-	void UpdateLightForBlock(BlockInfo currentBlockInfo);
-
-	void DirtyNeighboursOnLightChange(BlockInfo currentBlockInfo);
+	void VerifyLightingAroundLatestEdit();
+	size_t CompareLightingEditAgainstRelaxation(Chunk* centreChunk, LightingEngine& comparisonEngine, int localIndex, uint8_t newBlockType, std::vector<uint8_t>& groupBlockTypes, std::vector<uint8_t>& groupSkyFlags, std::vector<uint8_t>& relaxedLightValues);
 
 	void PlaceBlock(const RaycastResult3D& raycastResult, uint8_t controllerNumber, uint8_t selectedBlock);
 	void DigBlock(const RaycastResult3D& raycastResult, uint8_t controllerNumber);
 
 	void ModifyNeighbourChunksForEdgeBlocks(BlockInfo currentBlockInfo);
 
-	void RecalculateLightUponPlacing(BlockInfo currentBlockInfo);
-	void RecalculateLightUponDigging(BlockInfo currentBlockInfo);
+	void RelightColumnFromBlock(BlockInfo currentBlockInfo, int previousColumnHeight);
 
 	void CreateAndLoadPlayer(Player*& currentPlayer, Camera3D* playerCamera, const char* currentPlayerFileName);
 	void SaveAndDestroyPlayer(Player*& currentPlayer, const Camera3D* playerCamera, const char* currentPlayerFileName);
@@ -152,7 +215,7 @@ private:
 
 	Chunk* GetChunkAtWorldCoordinates(const Vector3& worldCoordinates);
 	BlockInfo GetBlockInfoForWorldCoordinates(const Vector3& blockWorldCoordinates);
-	Block* GetBlockForWorldCoordinates(const Vector3& blockWorldCoordinates);
+	Block GetBlockForWorldCoordinates(const Vector3& blockWorldCoordinates);
 	float GetColumnHeightForWorldXYCoordinates(const Vector2& worldXYCoordinates);
 
 	AABB3 GetBoundingBoxForBlockInfo(BlockInfo currentBlockInfo);
@@ -173,12 +236,40 @@ private:
 public:
 	ObjectPool<Chunk> m_ChunkPool;
 	Chunk* m_AllChunks[MAXIMUM_NUMBER_OF_CHUNKS] = { nullptr };
+	std::vector<size_t> m_FreeChunkSlots;
+	ActiveChunkMap m_ActiveChunkMap;
 	size_t m_NumberOfActiveChunks;
 	uint8_t m_RLEBuffer[4096U];
-
-	Thread* m_ChunkManagementThread;
-
-	std::deque<BlockInfo> m_DirtyBlocks;
+	uint32_t m_LatestMeshRevision;
+	std::vector<ChunkRebuildCandidate> m_ChunkRebuildQueue;
+	std::vector<ChunkRequest> m_DeferredMeshedRequests;
+	size_t m_NumberOfPendingMeshRebuilds;
+	bool m_GreedyMeshingIsEnabled;
+	bool m_PalettedBlockStorageIsEnabled;
+	size_t m_NumberOfChunkMeshVertices;
+	size_t m_NumberOfChunkMeshIndices;
+	uint64_t m_NumberOfUploadedMeshBytes;
+	size_t m_NumberOfWarmUpRebuilds;
+	size_t m_PreviousScratchAllocations;
+	size_t m_NumberOfScratchArenaGrowths;
+	size_t m_NumberOfBenchmarkedChunks;
+	double m_PerBlockVisibilityMilliseconds;
+	double m_RowMaskVisibilityMilliseconds;
+	size_t m_NumberOfComparedLightingEdits;
+	size_t m_NumberOfLightingMismatches;
+
+	std::vector<IntVector2> m_ChunkActivationOffsets;
+	std::vector<int> m_ChunkActivationSquaredDistances;
+	size_t m_ChunkActivationCursors[NUMBER_OF_PLAYERS];
+	IntVector2 m_ChunkActivationCentres[NUMBER_OF_PLAYERS];
+	Vector3 m_PreviousStreamingPositions[NUMBER_OF_PLAYERS];
+	Vector3 m_StreamingVelocities[NUMBER_OF_PLAYERS];
+
+	std::vector<Thread*> m_ChunkManagementThreads;
+
+	LightingEngine m_LightingEngine;
+	IntVector2 m_LatestEditedChunkCoordinates;
+	bool m_LightingNeedsVerification;
 	Light* m_AllWorldLights[MAXIMUM_NUMBER_OF_LIGHTS];
 
 	const SpriteSheet* m_DiffuseSpriteSheet;
@@ -209,5 +300,6 @@ public:
 
 	float m_PlayerAngleToSun;
 	float m_SkyRotation;
+	float m_SkyLightIntensity;
 	float m_WaterRipple;
 };
\ No newline at end of file
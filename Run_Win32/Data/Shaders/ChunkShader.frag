@@ -10,6 +10,8 @@ uniform float g_SpecularPower;
 
 
 const uint MAXIMUM_NUMBER_OF_LIGHTS = 16;
+const float TEXTURE_TILE_STRIDE = 256.0;
+const vec2 TEXTURE_ATLAS_DIMENSIONS = vec2(4.0, 4.0);
 
 uniform vec3 g_LightPosition[MAXIMUM_NUMBER_OF_LIGHTS];
 uniform vec3 g_LightColor[MAXIMUM_NUMBER_OF_LIGHTS];
@@ -91,6 +93,16 @@ TotalLight CalculateTotalLight(	vec3 surfacePosition,
 
 
 
+vec2 GetAtlasTextureCoordinates(vec2 tiledTextureCoordinates)
+{
+	vec2 tileCoordinates = floor(tiledTextureCoordinates / TEXTURE_TILE_STRIDE);
+	vec2 localCoordinates = tiledTextureCoordinates - (tileCoordinates * TEXTURE_TILE_STRIDE);
+
+	return (tileCoordinates + fract(localCoordinates)) / TEXTURE_ATLAS_DIMENSIONS;
+}
+
+
+
 vec4 ApplyFog(vec4 finalColor)
 {
 	vec3 viewDirection = normalize(passPosition - g_CameraPosition);
@@ -112,9 +124,11 @@ vec4 ApplyFog(vec4 finalColor)
 
 void main(void)
 {
-	vec4 diffuseColor = texture(g_DiffuseTexture, passTextureCoordinates);
-	vec3 normalColor = texture(g_NormalTexture, passTextureCoordinates).rgb;
-	float specularColor = texture(g_SpecularTexture, passTextureCoordinates).r;
+	vec2 textureCoordinates = GetAtlasTextureCoordinates(passTextureCoordinates);
+
+	vec4 diffuseColor = texture(g_DiffuseTexture, textureCoordinates);
+	vec3 normalColor = texture(g_NormalTexture, textureCoordinates).rgb;
+	float specularColor = texture(g_SpecularTexture, textureCoordinates).r;
 
 	// TODO: Multiply specular intensity here if needed.
 
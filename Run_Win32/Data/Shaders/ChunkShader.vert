@@ -5,6 +5,7 @@ uniform mat4 g_View;
 uniform mat4 g_Projection;
 
 uniform vec4 g_ClippingPlane;
+uniform float g_SkyLightIntensity;
 
 in vec3 inPosition;
 in vec4 inColor;
@@ -22,7 +23,13 @@ out vec3 passNormal;
 
 void main(void)
 {
-	passColor = inColor;
+	float blockLightValue = inColor.r * 15.0;
+	float skyLightValue = inColor.g * 15.0 * g_SkyLightIntensity;
+	float lightValue = max(blockLightValue, skyLightValue);
+
+	float lightIntensity = mix(50.0, 255.0, lightValue / 15.0) / 255.0;
+	passColor = vec4(vec3(lightIntensity), 1.0);
+
 	passTextureCoordinates = inTextureCoordinates;
 
 	vec4 position = vec4(inPosition, 1.0);
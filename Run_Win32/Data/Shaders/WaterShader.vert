@@ -5,8 +5,6 @@ uniform mat4 g_View;
 uniform mat4 g_Projection;
 
 in vec3 inPosition;
-in vec4 inColor;
-in vec3 inNormal;
 
 out vec4 clipPosition;
 out vec3 passPosition;
@@ -15,17 +13,23 @@ out vec2 passTextureCoordinates;
 out vec3 passNormal;
 
 const float g_TilingFactor = 0.1;
+const float g_SurfaceOffset = 0.25;
+const vec4 g_WaterColor = vec4(0.0, 191.0 / 255.0, 1.0, 1.0);
 
 void main(void)
 {
-	passColor = inColor;
-	passTextureCoordinates = (inPosition.xy / vec2(2.0, 2.0)) + vec2(0.5, 0.5);
-	passTextureCoordinates *= g_TilingFactor;
+	vec3 localPosition = inPosition;
+	localPosition.z -= g_SurfaceOffset;
+
+	passColor = g_WaterColor;
 
-	vec4 position = vec4(inPosition, 1.0);
+	vec4 position = vec4(localPosition, 1.0);
 	passPosition = vec4(position * g_Model).xyz;
 
-	vec4 normal = vec4(inNormal, 0.0);
+	passTextureCoordinates = (passPosition.xy / vec2(2.0, 2.0)) + vec2(0.5, 0.5);
+	passTextureCoordinates *= g_TilingFactor;
+
+	vec4 normal = vec4(0.0, 0.0, 1.0, 0.0);
 	passNormal = vec4(normal * g_Model).xyz;
 
 	position = position * g_Model * g_View * g_Projection;